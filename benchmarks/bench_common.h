@@ -0,0 +1,124 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_BENCH_COMMON_H
+#define VPUNN_BENCH_COMMON_H
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "vpu/layer.h"
+#include "vpu/types.h"
+
+/// @brief namespace for the microbenchmarks of the C++ library
+namespace VPUNN_bench {
+using namespace VPUNN;
+
+/// a model file shipped in the models folder, with the device it is trained for
+struct ModelInfo {
+    std::string name;  ///< file name without extension, used in the benchmark name
+    std::string path;  ///< full path of the file
+    VPUDevice device;  ///< device the model is trained for
+};
+
+/// @brief device a shipped model is trained for, deduced from the file name
+/// @returns false if the file name is not recognized
+inline bool device_from_model_name(const std::string& name, VPUDevice& device) {
+    const auto starts_with = [&name](const std::string& prefix) {
+        return name.rfind(prefix, 0) == 0;
+    };
+    if (starts_with("vpu_2_0")) {
+        device = VPUDevice::VPU_2_0;
+    } else if (starts_with("vpu_2_7") || starts_with("dma_2_7")) {
+        device = VPUDevice::VPU_2_7;
+    } else if (starts_with("vpu_4_") || starts_with("vpu_40") || starts_with("dma_4_0")) {
+        device = VPUDevice::VPU_4_0;
+    } else if (starts_with("vpu_5_") || starts_with("dmann_5_0")) {
+        device = VPUDevice::NPU_5_0;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// @brief all models in the models folder whose name starts with prefix and have the .vpunn extension, sorted by name
+inline std::vector<ModelInfo> shipped_models(const std::string& prefix) {
+    std::vector<ModelInfo> models;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(VPUNN_BENCH_MODELS_PATH, ec)) {
+        const auto& file{entry.path()};
+        const std::string name{file.stem().string()};
+        VPUDevice device{VPUDevice::__size};
+        if (file.extension() == ".vpunn" && name.rfind(prefix, 0) == 0 && device_from_model_name(name, device)) {
+            models.push_back({name, file.string(), device});
+        }
+    }
+    std::sort(models.begin(), models.end(), [](const ModelInfo& a, const ModelInfo& b) {
+        return a.name < b.name;
+    });
+    return models;
+}
+
+/// DPU models (vpu_*.vpunn)
+inline std::vector<ModelInfo> dpu_models() {
+    return shipped_models("vpu_");
+}
+
+/// DMA models (dma_*.vpunn, dmann_*.vpunn)
+inline std::vector<ModelInfo> dma_models() {
+    std::vector<ModelInfo> models{shipped_models("dma_")};
+    const auto nn_models{shipped_models("dmann_")};
+    models.insert(models.end(), nn_models.cbegin(), nn_models.cend());
+    return models;
+}
+
+/// data type natively supported by the device
+inline DataType native_type(const VPUDevice device) {
+    return (device == VPUDevice::VPU_2_0) ? DataType::UINT8 : DataType::FLOAT16;
+}
+
+/// @brief a typical 3x3 convolution workload
+inline DPUWorkload make_dpu_workload(const VPUDevice device, const unsigned int dim = 16,
+                                     const unsigned int channels = 64) {
+    const auto mode{device == VPUDevice::VPU_2_0 ? ExecutionMode::MATRIX : ExecutionMode::CUBOID_16x16};
+    return DPUWorkload{device,
+                       Operation::CONVOLUTION,
+                       {VPUTensor(dim, dim, channels, 1, native_type(device))},  // input dimensions
+                       {VPUTensor(dim, dim, channels, 1, native_type(device))},  // output dimensions
+                       {3, 3},                                                   // kernels
+                       {1, 1},                                                   // strides
+                       {1, 1, 1, 1},                                             // padding
+                       mode};
+}
+
+/// @brief n different workloads (all are cache misses the first time they are costed)
+inline std::vector<DPUWorkload> make_unique_dpu_workloads(const VPUDevice device, const unsigned int n) {
+    std::vector<DPUWorkload> wls;
+    wls.reserve(n);
+    for (unsigned int i = 0; i < n; ++i) {
+        wls.push_back(make_dpu_workload(device, 8 + (i % 32), 16 * (1 + (i / 32) % 16)));
+    }
+    return wls;
+}
+
+/// @brief a typical 3x3 convolution layer
+inline DPULayer make_dpu_layer(const VPUDevice device, const unsigned int dim = 56, const unsigned int channels = 64) {
+    return DPULayer{make_dpu_workload(device, dim, channels)};
+}
+
+/// registration functions, one per benchmark family
+void register_dpu_benchmarks();
+void register_dma_shave_benchmarks();
+void register_layer_benchmarks();
+
+}  // namespace VPUNN_bench
+
+#endif  // VPUNN_BENCH_COMMON_H
@@ -0,0 +1,102 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "vpu_cost_model.h"
+#include "vpu_dma_cost_model.h"
+
+namespace VPUNN_bench {
+
+namespace {
+
+const DMANNWorkload_NPU27 dma_wl_27{
+        VPUDevice::VPU_2_7,  // VPUDevice device;
+        3,                   // int num_planes;
+        8192,                // int length;
+        4096,                // int src_width;
+        512,                 // int dst_width;
+        128,                 // int src_stride;
+        0,                   // int dst_stride;
+        128,                 // int src_plane_stride;
+        1024,                // int dst_plane_stride;
+        MemoryDirection::DDR2DDR,
+};
+
+/// DMA workload for NPU4.0 and NPU5.0 descriptors
+DMANNWorkload_NPU40_50 make_dma_wl_40_50(const VPUDevice device) {
+    return DMANNWorkload_NPU40_50{
+            device,
+            8192,  // int src_width;
+            8192,  // int dst_width;
+            0,     // int num_dim;
+            {{{0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}}},
+            Num_DMA_Engine::Num_Engine_1,
+            MemoryDirection::DDR2CMX,
+    };
+}
+
+/// DMA cost with the NN model of a specific descriptor type, cache disabled so that every call runs the inference
+template <class DMADesc>
+void BM_DMA(benchmark::State& state, const ModelInfo& m, const DMADesc& wl) {
+    DMACostModel<DMADesc> model{m.path, false, 0 /*no cache*/};
+    if (!model.nn_initialized()) {
+        state.SkipWithError("DMA model not initialized");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.computeCycles(wl));
+    }
+}
+
+/// SHAVE cost for one operator of a device
+void BM_SHAVE(benchmark::State& state, const VPUDevice device, const std::string& op) {
+    const VPUCostModel model{};
+    const SHAVEWorkload wl{op,
+                           device,
+                           {VPUTensor(56, 56, 64, 1, DataType::FLOAT16)},
+                           {VPUTensor(56, 56, 64, 1, DataType::FLOAT16)}};
+    for (auto _ : state) {
+        std::string info;
+        benchmark::DoNotOptimize(model.SHAVE(wl, info));
+    }
+}
+
+/// number of SHAVE operators benchmarked per device, the first ones in the supported list
+constexpr std::size_t shave_ops_per_device{4};
+
+}  // namespace
+
+void register_dma_shave_benchmarks() {
+    for (const auto& m : dma_models()) {
+        const std::string name{"DMA/" + m.name};
+        if (m.device == VPUDevice::VPU_2_7) {
+            benchmark::RegisterBenchmark(name.c_str(), BM_DMA<DMANNWorkload_NPU27>, m, dma_wl_27)
+                    ->Unit(benchmark::kMicrosecond);
+        } else {
+            benchmark::RegisterBenchmark(name.c_str(), BM_DMA<DMANNWorkload_NPU40_50>, m, make_dma_wl_40_50(m.device))
+                    ->Unit(benchmark::kMicrosecond);
+        }
+    }
+
+    const VPUCostModel model{};
+    for (const auto device : {VPUDevice::VPU_2_7, VPUDevice::VPU_4_0, VPUDevice::NPU_5_0}) {
+        const auto ops{model.getShaveSupportedOperations(device)};
+        for (std::size_t i = 0; i < std::min(ops.size(), shave_ops_per_device); ++i) {
+            const std::string name{"SHAVE/" + VPUDevice_ToText.at(static_cast<int>(device)) + "/" + ops[i]};
+            benchmark::RegisterBenchmark(name.c_str(), BM_SHAVE, device, ops[i])->Unit(benchmark::kMicrosecond);
+        }
+    }
+}
+
+}  // namespace VPUNN_bench
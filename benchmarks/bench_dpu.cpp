@@ -0,0 +1,97 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "vpu_cost_model.h"
+
+namespace VPUNN_bench {
+
+namespace {
+
+/// cold start: load the model from file and run the first inference
+void BM_DPU_ColdStart(benchmark::State& state, const ModelInfo& m) {
+    const DPUWorkload wl{make_dpu_workload(m.device)};
+    for (auto _ : state) {
+        VPUCostModel model{m.path};
+        std::string info;
+        benchmark::DoNotOptimize(model.DPU(wl, info));
+    }
+}
+
+/// the same workload every time, answered by the cache after the first call
+void BM_DPU_CacheHit(benchmark::State& state, const ModelInfo& m) {
+    VPUCostModel model{m.path};
+    const DPUWorkload wl{make_dpu_workload(m.device)};
+    std::string info;
+    model.DPU(wl, info);  // warm up the cache
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.DPU(wl, info));
+    }
+}
+
+/// cache disabled, every call runs the inference
+void BM_DPU_CacheMiss(benchmark::State& state, const ModelInfo& m) {
+    VPUCostModel model{m.path, false, 0 /*no cache*/};
+    const std::vector<DPUWorkload> wls{make_unique_dpu_workloads(m.device, 256)};
+    std::string info;
+    std::size_t idx{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.DPU(wls[idx], info));
+        idx = (idx + 1) % wls.size();
+    }
+}
+
+/// batched DPU call, workloads are all different, cache disabled
+void BM_DPU_Batch(benchmark::State& state, const ModelInfo& m) {
+    VPUCostModel model{m.path, false, 0 /*no cache*/, static_cast<unsigned int>(state.range(1))};
+    const std::vector<DPUWorkload> wls{make_unique_dpu_workloads(m.device, static_cast<unsigned int>(state.range(0)))};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.DPU(wls));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// energy of a workload
+void BM_DPU_Energy(benchmark::State& state, const ModelInfo& m) {
+    VPUCostModel model{m.path};
+    const DPUWorkload wl{make_dpu_workload(m.device)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.DPUEnergy(wl));
+    }
+}
+
+}  // namespace
+
+void register_dpu_benchmarks() {
+    for (const auto& m : dpu_models()) {
+        benchmark::RegisterBenchmark(("DPU/ColdStart/" + m.name).c_str(), BM_DPU_ColdStart, m)
+                ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("DPU/CacheHit/" + m.name).c_str(), BM_DPU_CacheHit, m)
+                ->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("DPU/CacheMiss/" + m.name).c_str(), BM_DPU_CacheMiss, m)
+                ->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("DPU/Batch/" + m.name).c_str(), BM_DPU_Batch, m)
+                ->ArgNames({"workloads", "nn_batch"})
+                ->Args({100, 1})
+                ->Args({100, 10})
+                ->Args({1000, 1})
+                ->Args({1000, 100})
+                ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("DPU/Energy/" + m.name).c_str(), BM_DPU_Energy, m)
+                ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+}  // namespace VPUNN_bench
@@ -0,0 +1,83 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+#include "vpu/optimization/workload_optimization.h"
+#include "vpu_cost_model.h"
+#include "vpu_layer_cost_model.h"
+
+namespace VPUNN_bench {
+
+namespace {
+
+/// the layer level benchmarks are expensive, only the reference model of each device generation is used
+const std::vector<std::string> layer_models{"vpu_2_7", "vpu_4_0"};
+
+/// full layer costing: inter-tile split with the strategy, then the best intra-tile split of every tile
+void BM_Layer(benchmark::State& state, const ModelInfo& m, const VPUTilingStrategy strategy) {
+    VPULayerCostModel model{m.path, false, 0 /*no cache*/};
+    const DPULayer layer_ref{make_dpu_layer(m.device)};
+    const unsigned int nDPU{static_cast<unsigned int>(state.range(0))};
+    const unsigned int nTiles{static_cast<unsigned int>(state.range(1))};
+    for (auto _ : state) {
+        DPULayer layer{layer_ref};
+        benchmark::DoNotOptimize(model.Layer(layer, strategy, nDPU, nTiles));
+    }
+}
+
+/// intra-tile split search of one tile
+void BM_IntraTileSplit(benchmark::State& state, const ModelInfo& m) {
+    VPUCostModel model{m.path, false, 0 /*no cache*/};
+    const auto tiler{getDPUTiler(model)};
+    const DPULayer layer{make_dpu_layer(m.device)};
+    SplitOptions options{};
+    options.nDPU = static_cast<unsigned int>(state.range(0));
+    options.maxWorkloads = static_cast<unsigned int>(state.range(1));
+    for (auto _ : state) {
+        std::vector<DPUWorkloadsWithCyclesSplit> all_splits;
+        benchmark::DoNotOptimize(tiler->intraTileSplit(layer, options, &all_splits));
+        state.counters["splits"] = static_cast<double>(all_splits.size());
+    }
+}
+
+}  // namespace
+
+void register_layer_benchmarks() {
+    const std::vector<std::pair<VPUTilingStrategy, std::string>> strategies{
+            {VPUTilingStrategy::NONE, "NONE"},
+            {VPUTilingStrategy::SOH_Overlapped, "SOH_Overlapped"},
+            {VPUTilingStrategy::SOK, "SOK"},
+    };
+
+    for (const auto& m : dpu_models()) {
+        if (std::find(layer_models.cbegin(), layer_models.cend(), m.name) == layer_models.cend()) {
+            continue;
+        }
+        for (const auto& [strategy, strategy_name] : strategies) {
+            benchmark::RegisterBenchmark(("Layer/" + strategy_name + "/" + m.name).c_str(), BM_Layer, m, strategy)
+                    ->ArgNames({"nDPU", "nTiles"})
+                    ->Args({1, 2})
+                    ->Args({2, 2})
+                    ->Unit(benchmark::kMillisecond);
+        }
+        benchmark::RegisterBenchmark(("IntraTileSplit/" + m.name).c_str(), BM_IntraTileSplit, m)
+                ->ArgNames({"nDPU", "maxWorkloads"})
+                ->Args({1, 50})
+                ->Args({2, 128})
+                ->Unit(benchmark::kMillisecond);
+    }
+}
+
+}  // namespace VPUNN_bench
@@ -0,0 +1,47 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+/// vpunn_bench entry point.
+/// Standard Google Benchmark arguments are accepted (e.g. --benchmark_filter=DPU/).
+/// Results are also written in JSON format to vpunn_bench.json unless --benchmark_out is given explicitly.
+int main(int argc, char** argv) {
+    std::vector<char*> args(argv, argv + argc);
+
+    std::string out_arg{"--benchmark_out=vpunn_bench.json"};
+    std::string out_format_arg{"--benchmark_out_format=json"};
+    const bool has_out{std::any_of(args.cbegin(), args.cend(), [](const char* arg) {
+        return std::strncmp(arg, "--benchmark_out=", std::strlen("--benchmark_out=")) == 0;
+    })};
+    if (!has_out) {
+        args.push_back(out_arg.data());
+        args.push_back(out_format_arg.data());
+    }
+
+    int args_count{static_cast<int>(args.size())};
+    benchmark::Initialize(&args_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+        return 1;
+    }
+
+    VPUNN_bench::register_dpu_benchmarks();
+    VPUNN_bench::register_dma_shave_benchmarks();
+    VPUNN_bench::register_layer_benchmarks();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -11,6 +11,7 @@
 #define VPUNN_CACHE
 
 #include <list>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <vector>
@@ -20,7 +21,9 @@
 
 #include <cassert>
 
+#include "core/fingerprint_lru_store.h"
 #include "core/persistent_cache.h"
+#include "core/shared_registry.h"
 #include "core/utils.h"
 #include "core/map_type_selector.h"
 
@@ -35,9 +38,9 @@ protected:
             : deserialized_table{[&]() {
                   auto env_override = check_if_env_path_override();
                   if (!env_override.empty()) {
-                      return FixedCache(env_override);
+                      return load_shared(env_override);
                   }
-                  return FixedCache(decideCacheFilename(filename, prio2_loadIfPairedCacheExists));
+                  return load_shared(decideCacheFilename(filename, prio2_loadIfPairedCacheExists));
               }()} {
     }
 
@@ -45,19 +48,19 @@ protected:
             : deserialized_table{[&]() {
                   auto env_override = check_if_env_path_override();
                   if (!env_override.empty()) {
-                      return FixedCache(env_override);
+                      return load_shared(env_override);
                   }
-                  return FixedCache(file_data, file_data_length);
+                  return load_shared(file_data, file_data_length);
               }()} {
     }
 
 protected:
     bool contains(const K& wl) const {
         if constexpr (has_hash_v<K>) {
-            if (deserialized_table.contains(wl.hash()))
+            if (deserialized_table->contains(wl.hash()))
                 return true;
         } else {
-            if (deserialized_table.contains(NNDescriptor<float>(wl).hash()))
+            if (deserialized_table->contains(NNDescriptor<float>(wl).hash()))
                 return true;
         }
         return false;
@@ -72,14 +75,38 @@ protected:
             wlhash = NNDescriptor<float>(wl).hash();
         }
 
-        return deserialized_table.get(wlhash);
+        const std::optional<float> found{deserialized_table->find(wlhash)};
+        if (found) {
+            counter.hit();
+        } else {
+            counter.miss();
+        }
+        return found;
     }
 
 private:
     /// loaded from file, must be loaded from a file with the same descriptor signature
     /// @note this is a draft implementation
     /// This datatype knows it is a float Value and uint32 key. this beats the K, V template
-    const FixedCache deserialized_table;  // maybe send it as template, OR reuse V and hashable K?
+    /// Read only, shared with the other caches loaded from the same file or data, @sa SharedRegistry
+    /// maybe send it as template, OR reuse V and hashable K?
+    const std::shared_ptr<const FixedCache> deserialized_table;
+    mutable AccessCounter counter{};  ///< accesses of this cache to the shared table
+
+    /// the table of a cache file, loaded only if no other cache holds it
+    static std::shared_ptr<const FixedCache> load_shared(const std::string& filename) {
+        return SharedRegistry<const FixedCache>::instance().get(file_identity(filename), [&filename]() {
+            return std::make_shared<const FixedCache>(filename);
+        });
+    }
+
+    /// the table of a cache content, loaded only if no other cache holds the same content
+    static std::shared_ptr<const FixedCache> load_shared(const char* file_data, size_t file_data_length) {
+        const std::string key{file_data ? content_identity(file_data, file_data_length) : std::string{"data:none"}};
+        return SharedRegistry<const FixedCache>::instance().get(key, [file_data, file_data_length]() {
+            return std::make_shared<const FixedCache>(file_data, file_data_length);
+        });
+    }
 
     /// @brief Decide which cache file to load  (DRAFT
     /// @param filenamePrio1 the first filename to try to load. must be a valid name and extension.Must be empty to go
@@ -109,7 +136,7 @@ private:
 
 public:
     const AccessCounter& getPreloadedCacheCounter() const {
-        return deserialized_table.getCounter();
+        return counter;
     }
 };
 
@@ -120,6 +147,11 @@ public:
  * 
  * Uses std::unordered_map for O(1) average lookup when specialized (e.g., DPUWorkload, std::vector<float>)
  * Falls back to std::map for other types (O(log n) lookup)
+ *
+ * For keys that have a fingerprint (DPUWorkload, NN descriptors) the dynamic part can store only the 128 bit
+ * fingerprint of each key instead of the key (CacheKeyMode::FINGERPRINT), @see FingerprintLRUStore. This is selected
+ * with the environment variable VPUNN_CACHE_KEY_MODE=FINGERPRINT, or with set_key_mode().
+ * VPUNN_CACHE_VERIFY_KEYS=TRUE keeps also the full keys to detect fingerprint collisions (debug).
  */
 template <typename K, typename V>
 class LRUCache : public FixedCacheAddON<K, V> {
@@ -140,6 +172,9 @@ private:
 
     mutable std::shared_mutex mtx;  ///< Mutex to protect shared resources.
 
+    CacheKeyMode key_mode{CacheKeyMode::FULL_KEY};        ///< how the dynamic part stores the keys
+    std::unique_ptr<FingerprintLRUStore<K, V>> compact;  ///< dynamic part in FINGERPRINT mode, replaces list and map
+
 public:
     /**
      * @brief Construct a new LRUCache object
@@ -149,11 +184,52 @@ public:
     explicit LRUCache(size_t max_size, const std::string& filename = "",
                       const std::string& prio2_loadIfPairedCacheExists = "")
             : FixedCacheAddON<K, V>(filename, prio2_loadIfPairedCacheExists), max_size(max_size) {
+        set_key_mode(key_mode_from_env(), verify_keys_from_env());
     }
 
     // const char* model_data, size_t model_data_length, bool copy_model_data
     explicit LRUCache(size_t max_size, const char* file_data, size_t file_data_length)
             : FixedCacheAddON<K, V>(file_data, file_data_length), max_size(max_size) {
+        set_key_mode(key_mode_from_env(), verify_keys_from_env());
+    }
+
+    /**
+     * @brief Changes how the dynamic part stores its keys, the dynamic content is dropped. Keys without a fingerprint
+     * always use FULL_KEY. Must not run concurrently with other operations on the cache
+     *
+     * @param mode the key mode
+     * @param verify_keys FINGERPRINT mode only: keep also the full keys and compare them on hits (debug)
+     * @return the mode in use
+     */
+    CacheKeyMode set_key_mode(const CacheKeyMode mode, const bool verify_keys = false) {
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        workloads.clear();
+        m_table.clear();
+        compact.reset();
+        key_mode = CacheKeyMode::FULL_KEY;
+        if constexpr (has_fingerprint_v<K>) {
+            if (mode == CacheKeyMode::FINGERPRINT) {
+                compact = std::make_unique<FingerprintLRUStore<K, V>>(max_size, verify_keys);
+                key_mode = CacheKeyMode::FINGERPRINT;
+            }
+        }
+        return key_mode;
+    }
+
+    CacheKeyMode get_key_mode() const noexcept {
+        return key_mode;
+    }
+
+    /// @brief number of entries in the dynamic part
+    size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        return compact ? compact->size() : m_table.size();
+    }
+
+    /// @brief FINGERPRINT mode with key verification: fingerprints found to match a different key
+    size_t get_fingerprint_collisions() const {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        return compact ? compact->get_collisions() : 0;
     }
 
     /**
@@ -174,6 +250,13 @@ public:
         if (FixedCacheAddON<K, V>::contains(wl))
             return;
 
+        if constexpr (has_fingerprint_v<K>) {
+            if (compact) {
+                compact->add(fingerprint_of(wl), wl, value);
+                return;
+            }
+        }
+
         const Map_Iter_cnst& map_it{m_table.find(wl)};
         if (map_it == m_table.cend()) {
             // Insert items in the list and map
@@ -208,6 +291,20 @@ public:
             }
         }
 
+        if constexpr (has_fingerprint_v<K>) {
+            if (key_mode == CacheKeyMode::FINGERPRINT) {
+                const Fingerprint128 fp{fingerprint_of(wl)};  // outside of the lock
+                std::unique_lock<std::shared_mutex> lock(mtx);
+                if (compact) {
+                    const std::optional<V> found{compact->get(fp, wl)};
+                    if (found && source) {
+                        *source = "dyn_cache";
+                    }
+                    return found;
+                }
+            }
+        }
+
         // First, try to find the key with a shared lock
         {
             std::shared_lock<std::shared_mutex> lock(mtx);
@@ -230,6 +327,15 @@ public:
     }
 
 private:
+    static CacheKeyMode key_mode_from_env() {
+        return (get_env_vars({"VPUNN_CACHE_KEY_MODE"}).at("VPUNN_CACHE_KEY_MODE") == "FINGERPRINT")
+                       ? CacheKeyMode::FINGERPRINT
+                       : CacheKeyMode::FULL_KEY;
+    }
+    static bool verify_keys_from_env() {
+        return get_env_vars({"VPUNN_CACHE_VERIFY_KEYS"}).at("VPUNN_CACHE_VERIFY_KEYS") == "TRUE";
+    }
+
     /**
      * @brief Remove a workload from the cache
      *
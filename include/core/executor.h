@@ -0,0 +1,131 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_EXECUTOR_H
+#define VPUNN_EXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/vpunn_api.h"
+
+namespace VPUNN {
+
+/**
+ * @brief Runs the iterations of a loop, possibly in parallel.
+ *
+ * The cost models use it for their internal parallel loops. The default is serial; an integration can attach the
+ * WorkStealingThreadPool of the library, or adapt its own scheduler (TBB, the pool of the compiler) by implementing
+ * this interface, so that the cost model does not create threads of its own.
+ */
+class IExecutor {
+public:
+    /**
+     * @brief runs body(idx) for each idx in [0, count), returns when all iterations are done
+     * The iterations may run in any order and in parallel. The body may call parallel_for again (nested loops).
+     *
+     * @throws the first exception thrown by the body, when no iteration runs anymore. The iterations not yet started
+     * may be skipped after an exception
+     */
+    virtual void parallel_for(const std::size_t count, const std::function<void(std::size_t)>& body) = 0;
+
+    /// @brief how many iterations can run at the same time, at least 1
+    virtual unsigned int concurrency() const noexcept = 0;
+
+    virtual ~IExecutor() = default;
+};
+
+/// @brief runs the iterations in order, in the calling thread
+class SerialExecutor final : public IExecutor {
+public:
+    void parallel_for(const std::size_t count, const std::function<void(std::size_t)>& body) override {
+        for (std::size_t idx = 0; idx < count; idx++) {
+            body(idx);
+        }
+    }
+    unsigned int concurrency() const noexcept override {
+        return 1;
+    }
+};
+
+/**
+ * @brief Thread pool with work stealing.
+ *
+ * A parallel_for is split in chunks that are distributed to the queues of the workers. A worker runs the newest chunk
+ * of its own queue and, when its queue is empty, steals the oldest chunk of another queue. The calling thread runs
+ * chunks too while it waits, so parallel_for can be nested (also from inside the workers) without deadlocks.
+ */
+class VPUNN_API WorkStealingThreadPool final : public IExecutor {
+public:
+    /// @brief pool configuration
+    struct Options {
+        unsigned int threads{0};  ///< worker threads, 0 means hardware concurrency - 1 (the caller works too)
+        std::vector<int> cpu_affinity{};  ///< worker i is pinned to cpu_affinity[i % size], empty for no pinning.
+                                          ///< Applied only on Linux
+    };
+
+    explicit WorkStealingThreadPool(const Options& options);
+    WorkStealingThreadPool(): WorkStealingThreadPool(Options{}) {
+    }
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+    ~WorkStealingThreadPool() override;
+
+    void parallel_for(const std::size_t count, const std::function<void(std::size_t)>& body) override;
+
+    /// @brief workers plus the calling thread
+    unsigned int concurrency() const noexcept override {
+        return static_cast<unsigned int>(workers.size()) + 1;
+    }
+
+    /// @brief number of chunks executed by a thread other than the one they were queued to, since construction
+    std::size_t get_steals() const noexcept {
+        return steals.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Job;
+    /// iterations [begin, end) of a job
+    struct Chunk {
+        Job* job;
+        std::size_t begin;
+        std::size_t end;
+    };
+    /// the queue of one worker, the owner uses the back, thieves the front
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Chunk> chunks;
+    };
+
+    void worker_loop(const std::size_t own_queue);
+    /// runs one chunk, from the own queue first (if any) then stolen from others. @returns false if none was found
+    bool run_one(const std::size_t own_queue);
+    static void run_chunk(const Chunk& chunk);
+
+    std::vector<std::unique_ptr<Queue>> queues;  ///< one per worker
+    std::vector<std::thread> workers;            ///< the worker threads
+    std::atomic<std::size_t> queued{0};          ///< chunks in all the queues
+    std::atomic<std::size_t> steals{0};          ///< chunks run by another thread than their queue owner
+    std::atomic<std::size_t> next_queue{0};      ///< round robin start for the distribution of the chunks
+
+    std::mutex sleep_mutex;             ///< protects stop, together with sleep_cv
+    std::condition_variable sleep_cv;   ///< idle workers wait here for chunks
+    bool stop{false};                   ///< the pool is being destroyed
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_EXECUTOR_H
@@ -0,0 +1,123 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_FINGERPRINT_H
+#define VPUNN_FINGERPRINT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace VPUNN {
+
+/// @brief 128 bit digest of a key, two different keys have the same fingerprint with negligible probability
+struct Fingerprint128 {
+    std::uint64_t hi{0};
+    std::uint64_t lo{0};
+
+    bool operator==(const Fingerprint128& b) const noexcept {
+        return hi == b.hi && lo == b.lo;
+    }
+    bool operator!=(const Fingerprint128& b) const noexcept {
+        return !(*this == b);
+    }
+};
+
+/**
+ * @brief Accumulates values into a Fingerprint128.
+ *
+ * Two independent 64 bit lanes (an xxHash64 like round and a splitmix64 mix) digest the same sequence of values, the
+ * result is avalanched. Not a cryptographic hash, it only has to tell apart the keys of a cache.
+ */
+class FingerprintBuilder {
+public:
+    FingerprintBuilder& add(const std::uint64_t value) noexcept {
+        a += value * prime2;
+        a = rotl(a, 31) * prime1;
+        b = mix(b + value + golden);
+        ++count;
+        return *this;
+    }
+
+    /// @brief adds the length and the bytes of a text
+    FingerprintBuilder& add(const std::string& text) noexcept {
+        return add(text.data(), text.size());
+    }
+
+    /// @brief adds the length and the content of a memory buffer
+    FingerprintBuilder& add(const char* data, const std::size_t size) noexcept {
+        add(static_cast<std::uint64_t>(size));
+        for (std::size_t pos = 0; pos < size; pos += sizeof(std::uint64_t)) {
+            std::uint64_t chunk{0};
+            std::memcpy(&chunk, data + pos, std::min(sizeof(chunk), size - pos));
+            add(chunk);
+        }
+        return *this;
+    }
+
+    Fingerprint128 result() const noexcept {
+        return {mix(a ^ (count * prime1)), mix(b ^ rotl(a, 17))};
+    }
+
+private:
+    static constexpr std::uint64_t prime1{0x9E3779B185EBCA87ULL};
+    static constexpr std::uint64_t prime2{0xC2B2AE3D27D4EB4FULL};
+    static constexpr std::uint64_t golden{0x9E3779B97F4A7C15ULL};
+
+    static constexpr std::uint64_t rotl(const std::uint64_t x, const int r) noexcept {
+        return (x << r) | (x >> (64 - r));
+    }
+    /// splitmix64 finalizer
+    static constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    std::uint64_t a{0x27D4EB2F165667C5ULL};  ///< first lane
+    std::uint64_t b{0x165667B19E3779F9ULL};  ///< second lane
+    std::uint64_t count{0};                  ///< number of added values
+};
+
+/// the fingerprint of a NN descriptor, from the exact bits of its values
+inline Fingerprint128 fingerprint_of(const std::vector<float>& descriptor) noexcept {
+    FingerprintBuilder builder;
+    builder.add(descriptor.size());
+    for (const float value : descriptor) {
+        std::uint32_t bits{0};
+        std::memcpy(&bits, &value, sizeof(bits));
+        builder.add(bits);
+    }
+    return builder.result();
+}
+
+/// the fingerprint of a key that provides one, like DPUWorkload
+template <typename K>
+auto fingerprint_of(const K& key) noexcept -> decltype(key.fingerprint()) {
+    return key.fingerprint();
+}
+
+/// true if fingerprint_of(K) exists
+template <typename, typename = std::void_t<>>
+struct has_fingerprint : std::false_type {};
+
+template <typename K>
+struct has_fingerprint<K, std::void_t<decltype(fingerprint_of(std::declval<const K&>()))>> : std::true_type {};
+
+template <typename K>
+inline constexpr bool has_fingerprint_v = has_fingerprint<K>::value;
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_FINGERPRINT_H
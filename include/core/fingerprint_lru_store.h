@@ -0,0 +1,197 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_FINGERPRINT_LRU_STORE_H
+#define VPUNN_FINGERPRINT_LRU_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "core/fingerprint.h"
+
+namespace VPUNN {
+
+/// @brief how a dynamic cache identifies its keys
+enum class CacheKeyMode {
+    FULL_KEY,     ///< the whole key is stored (twice: in the LRU list and in the map)
+    FINGERPRINT,  ///< only a 128 bit fingerprint of the key is stored, in flat arrays
+};
+
+/**
+ * @brief LRU storage of values identified by the Fingerprint128 of their keys, for the compact mode of LRUCache.
+ *
+ * The entries (fingerprint, value, LRU links) are in one flat array, located by an open addressing index (linear
+ * probing, no tombstones) of twice the capacity. Per entry this costs a few tens of bytes, independent of the key
+ * size. With verify_keys the full keys are stored too and compared on each hit, a fingerprint collision is then
+ * counted and treated as a miss; this is a debug aid, it costs the memory the fingerprints save.
+ * Not thread safe.
+ */
+template <typename K, typename V>
+class FingerprintLRUStore {
+public:
+    FingerprintLRUStore(const std::size_t capacity, const bool verify_keys)
+            : capacity{capacity}, verify_keys{verify_keys}, index(index_size(capacity), none) {
+    }
+
+    /// @brief the value of the key, which becomes the most recently used. Empty if not present
+    std::optional<V> get(const Fingerprint128& fp, const K& key) {
+        const std::size_t pos{find(fp)};
+        if (index[pos] == none) {
+            return std::nullopt;
+        }
+        const std::uint32_t id{index[pos]};
+        if (verify_keys && !(keys[id] == key)) {
+            ++collisions;
+            return std::nullopt;
+        }
+        move_to_front(id);
+        return entries[id].value;
+    }
+
+    /// @brief adds the key if not present, evicting the least recently used entry if full. An existing value is kept
+    /// and becomes the most recently used
+    void add(const Fingerprint128& fp, const K& key, const V& value) {
+        if (capacity == 0) {
+            return;
+        }
+        std::size_t pos{find(fp)};
+        if (index[pos] != none) {
+            if (verify_keys && !(keys[index[pos]] == key)) {
+                ++collisions;
+            }
+            move_to_front(index[pos]);
+            return;
+        }
+
+        std::uint32_t id{0};
+        if (entries.size() < capacity) {
+            id = static_cast<std::uint32_t>(entries.size());
+            entries.push_back({fp, value, none, none});
+            if (verify_keys) {
+                keys.push_back(key);
+            }
+        } else {  // reuse the slot of the least recently used
+            id = tail;
+            erase_from_index(find(entries[id].fp));
+            unlink(id);
+            entries[id].fp = fp;
+            entries[id].value = value;
+            if (verify_keys) {
+                keys[id] = key;
+            }
+            pos = find(fp);  // the erase may have moved the free position
+        }
+        index[pos] = id;
+        push_front(id);
+    }
+
+    std::size_t size() const noexcept {
+        return entries.size();
+    }
+
+    /// @brief hits or adds whose fingerprint matched a different key, only counted with verify_keys
+    std::size_t get_collisions() const noexcept {
+        return collisions;
+    }
+
+    /// @brief memory of the storage, excluding the verification keys
+    std::size_t size_in_bytes() const noexcept {
+        return entries.capacity() * sizeof(Entry) + index.capacity() * sizeof(std::uint32_t);
+    }
+
+private:
+    static constexpr std::uint32_t none{std::numeric_limits<std::uint32_t>::max()};
+
+    struct Entry {
+        Fingerprint128 fp;
+        V value;
+        std::uint32_t prev;  ///< more recently used neighbour, none for the head
+        std::uint32_t next;  ///< less recently used neighbour, none for the tail
+    };
+
+    /// power of two, at least twice the capacity so that the probe sequences stay short
+    static std::size_t index_size(const std::size_t capacity) {
+        std::size_t size{2};
+        while (size < 2 * capacity) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    std::size_t home(const Fingerprint128& fp) const noexcept {
+        return static_cast<std::size_t>(fp.lo) & (index.size() - 1);
+    }
+
+    /// the index position of fp, or the free position where it would be inserted
+    std::size_t find(const Fingerprint128& fp) const noexcept {
+        const std::size_t mask{index.size() - 1};
+        std::size_t pos{home(fp)};
+        while (index[pos] != none && entries[index[pos]].fp != fp) {
+            pos = (pos + 1) & mask;
+        }
+        return pos;
+    }
+
+    /// frees a position of the index and shifts back the following entries of the probe sequence
+    void erase_from_index(std::size_t hole) noexcept {
+        const std::size_t mask{index.size() - 1};
+        for (std::size_t pos = (hole + 1) & mask; index[pos] != none; pos = (pos + 1) & mask) {
+            const std::size_t distance_from_home{(pos - home(entries[index[pos]].fp)) & mask};
+            if (distance_from_home >= ((pos - hole) & mask)) {  // can be found also from the hole
+                index[hole] = index[pos];
+                hole = pos;
+            }
+        }
+        index[hole] = none;
+    }
+
+    void unlink(const std::uint32_t id) noexcept {
+        Entry& e{entries[id]};
+        (e.prev != none ? entries[e.prev].next : head) = e.next;
+        (e.next != none ? entries[e.next].prev : tail) = e.prev;
+        e.prev = e.next = none;
+    }
+
+    void push_front(const std::uint32_t id) noexcept {
+        Entry& e{entries[id]};
+        e.prev = none;
+        e.next = head;
+        if (head != none) {
+            entries[head].prev = id;
+        }
+        head = id;
+        if (tail == none) {
+            tail = id;
+        }
+    }
+
+    void move_to_front(const std::uint32_t id) noexcept {
+        if (head != id) {
+            unlink(id);
+            push_front(id);
+        }
+    }
+
+    const std::size_t capacity;  ///< max entries
+    const bool verify_keys;      ///< the full keys are kept and compared
+
+    std::vector<Entry> entries;        ///< the entries, at most capacity
+    std::vector<std::uint32_t> index;  ///< entry id by fingerprint position, none if free
+    std::vector<K> keys;               ///< the key of each entry, only with verify_keys
+    std::uint32_t head{none};          ///< most recently used entry
+    std::uint32_t tail{none};          ///< least recently used entry
+    std::size_t collisions{0};         ///< fingerprints matching another key
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_FINGERPRINT_LRU_STORE_H
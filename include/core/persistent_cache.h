@@ -179,6 +179,15 @@ public:
         return counter;
     }
 
+    /// getter that does not count the access, for the users that share the table and count on their own
+    std::optional<float> find(const uint32_t& wl) const {
+        float value = 0;
+        if (ThreadSafeMap::find(wl, value)) {
+            return value;
+        }
+        return std::nullopt;
+    }
+
     /// special getter to increment access counter
     std::optional<float> get(const uint32_t& wl) const {
         float value = 0;
@@ -11,6 +11,10 @@
 #define CORE_PROFILING_H
 
 #include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace VPUNN {
 
@@ -95,6 +99,64 @@ public:
     }
 };
 
+/**
+ * @brief Durations of the named phases of a long operation (like the construction of a cost model), for a
+ * startup timing breakdown
+ */
+class PhaseTimes {
+public:
+    /**
+     * @brief runs a phase and records its duration, also if it throws
+     *
+     * @param name of the phase
+     * @param phase callable without parameters
+     * @return what the phase returns (also a reference)
+     */
+    template <typename Phase>
+    auto measure(const char* name, Phase&& phase) -> decltype(phase()) {
+        const Recorder recorder{*this, name};
+        return phase();
+    }
+
+    /// @brief the phases in execution order, with their duration in milliseconds
+    const std::vector<std::pair<std::string, double>>& phases() const noexcept {
+        return durations;
+    }
+
+    /// @brief the sum of the phases, milliseconds
+    double total() const noexcept {
+        double sum{0.0};
+        for (const auto& phase : durations) {
+            sum += phase.second;
+        }
+        return sum;
+    }
+
+    /// @brief the phases and the total, as "name: x ms, ..., total: y ms"
+    std::string to_string() const {
+        std::ostringstream out;
+        for (const auto& phase : durations) {
+            out << phase.first << ": " << phase.second << " ms, ";
+        }
+        out << "total: " << total() << " ms";
+        return out.str();
+    }
+
+private:
+    /// records the time from its creation to its destruction
+    struct Recorder {
+        PhaseTimes& times;
+        const char* name;
+        const std::chrono::high_resolution_clock::time_point start{tick()};
+
+        ~Recorder() {
+            times.durations.emplace_back(name, tock(start));
+        }
+    };
+
+    std::vector<std::pair<std::string, double>> durations;  ///< name and duration of each phase
+};
+
 }  // namespace VPUNN
 
 #endif  // CORE_PROFILING_H
@@ -16,6 +16,7 @@
 #include <functional>
 #include <ios>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -31,6 +32,7 @@
 #include "core/utils.h"
 #include "vpu/dma_types.h"
 #include "vpu/dpu_types.h"
+#include "vpu/serialization/member_fields.h"
 #include "vpu/serializer_utils.h"
 #include "vpu/utils.h"
 
@@ -556,6 +558,7 @@ public:
         file.close();
         write_tokens_map.clear();
         index_map.clear();
+        clear_field_columns();
     }
 
     /// @brief Jump to the beginning of the file and skip header line
@@ -693,8 +696,19 @@ public:
         auto operation = [&](auto& arg) {
             using argtype = std::remove_reference_t<decltype(arg)>;  // Decayed type of the argument
 
+            // Check if currently evaluated type has a compile time field table
+            if constexpr (has_member_fields_v<std::remove_const_t<argtype>>) {
+                const auto& fields = std::remove_const_t<argtype>::_get_member_fields();
+                const auto& columns = get_field_columns(fields);  // resolved once per schema
+                for (std::size_t i = 0; i < fields.size(); ++i) {
+                    if (columns[i] >= 0) {
+                        write_tokens[columns[i]] = fields[i].to_text(arg);
+                    }
+                }
+            }
+
             // Check if currently evaluated type has a member map
-            if constexpr (has_member_map_v<argtype>) {
+            else if constexpr (has_member_map_v<argtype>) {
                 //  Iterate over the member map and serialize each member if it exists in the index map
                 for (auto& [key, value] : arg.get_member_map()) {
                     if (index_map.count(key) > 0) {
@@ -788,8 +802,32 @@ public:
         auto operation = [&](auto& arg) {
             using argtype = std::remove_reference_t<decltype(arg)>;  // Decayed type of the argument
 
+            // Check if currently evaluated type has a compile time field table
+            if constexpr (has_member_fields_v<argtype>) {
+                const auto& fields = argtype::_get_member_fields();
+                const auto& columns = get_field_columns(fields);  // resolved once per schema
+                // table order is kept, computed fields are defined after the fields they depend on
+                for (std::size_t i = 0; i < fields.size(); ++i) {
+                    const auto& field = fields[i];
+                    if (columns[i] >= 0 && columns[i] < static_cast<int>(read_tokens.size())) {
+                        const std::string& token = read_tokens[columns[i]];
+                        if (token.empty())
+                            continue;  // empty value, skip
+
+                        if (!field.from_text(arg, token)) {
+                            throw std::runtime_error(std::string("Deserialize: Conversion failed for key:") +
+                                                     field.name + " ss:" + token + "$END");
+                        }
+                    } else if (field.on_absent != nullptr) {
+                        // field not found in index_map, its value can be computed based on a set of rules or
+                        // could be default
+                        field.on_absent(arg);
+                    }
+                }
+            }
+
             // Check if currently evaluated type has a member map
-            if constexpr (has_member_map_v<argtype>) {
+            else if constexpr (has_member_map_v<argtype>) {
                 const auto& member_names = argtype::_get_member_names();
                 // Iterate over the member_names and deserialize each member if it exists in the index map
                 for (auto& key_member : member_names) {
@@ -948,6 +986,37 @@ private:
     std::recursive_mutex file_mutex{};            ///> Mutex to protect file operations from concurrent access
     mutable std::mutex write_tokens_map_mutex{};  ///> Mutex to protect write_tokens_map from concurrent access
 
+    /// column position of each field of a field table (-1 if not present), keyed by the table address.
+    /// Resolved at first use of a record type and invalidated when the index map changes.
+    std::map<const void*, std::vector<int>> field_columns{};
+    std::mutex field_columns_mutex{};  ///> Mutex to protect field_columns from concurrent access
+
+    /// @brief Get the column position of each field in a field table, resolves them at first call
+    /// @param fields the compile time field table of a record type
+    /// @return vector with a position in the write/read buffers for each field, -1 if the field is not present
+    template <class Owner, std::size_t N>
+    const std::vector<int>& get_field_columns(const MemberFieldTable<Owner, N>& fields) {
+        std::lock_guard<std::mutex> lock(field_columns_mutex);
+        auto it = field_columns.find(fields.data());
+        if (it == field_columns.end()) {
+            std::vector<int> columns(N, -1);
+            for (std::size_t i = 0; i < N; ++i) {
+                const auto pos = index_map.find(fields[i].name);
+                if (pos != index_map.end()) {
+                    columns[i] = pos->second;
+                }
+            }
+            it = field_columns.emplace(fields.data(), std::move(columns)).first;
+        }
+        return it->second;  // map nodes are stable, reference is valid until the next index map change
+    }
+
+    /// @brief Drops the resolved field columns, must be called when the index map changes
+    void clear_field_columns() {
+        std::lock_guard<std::mutex> lock(field_columns_mutex);
+        field_columns.clear();
+    }
+
     /// @brief Create an index map to store positions of each unique identifier of a field.
     /// Eg. Positions of each column in a CSV file
     /// For CSV, the index map is based on the header line
@@ -967,6 +1036,7 @@ private:
         for (size_t idx = 0; idx < header_keys.size(); ++idx) {
             index_map[header_keys[idx]] = static_cast<int>(idx);
         }
+        clear_field_columns();
 
         auto write_tokens_opt = get_write_tokens(true);  // Get write tokens for the current thread, create if empty
         if (!write_tokens_opt.has_value()) {
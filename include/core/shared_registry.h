@@ -0,0 +1,113 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_SHARED_REGISTRY_H
+#define VPUNN_SHARED_REGISTRY_H
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include "core/fingerprint.h"
+
+namespace VPUNN {
+
+/**
+ * @brief Process wide registry of read only objects that are expensive to load (NN runtimes, fixed caches, SHAVE
+ * providers), shared by all the cost model instances that ask for the same key.
+ *
+ * An object is loaded at the first request of its key and is shared as long as at least one instance holds it. When
+ * the last holder releases it the object is freed, a later request loads it again. So the memory follows the number of
+ * distinct models in use, not the number of cost model instances.
+ * Thread safe. The loads are serialized, a loader must not use the same registry.
+ *
+ * @tparam T the shared type, normally const qualified
+ */
+template <typename T>
+class SharedRegistry {
+public:
+    /// @brief statistics since process start
+    struct Stats {
+        std::size_t loads{0};  ///< objects loaded
+        std::size_t hits{0};   ///< requests served with an already loaded object
+        std::size_t alive{0};  ///< objects currently held by some instance
+    };
+
+    /// @brief the registry of this type
+    static SharedRegistry& instance() {
+        static SharedRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief the object of the key, loaded now if no instance holds it
+     *
+     * @param key identifies the content, @sa file_identity and content_identity
+     * @param load makes the object, returns a std::shared_ptr<T>. Its exceptions are propagated, nothing is registered
+     */
+    template <typename Loader>
+    std::shared_ptr<T> get(const std::string& key, Loader&& load) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto& entry{entries[key]};
+        if (auto existing{entry.lock()}) {
+            ++stats.hits;
+            return existing;
+        }
+        std::shared_ptr<T> loaded{std::forward<Loader>(load)()};
+        entry = loaded;
+        ++stats.loads;
+        return loaded;
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        Stats result{stats};
+        for (const auto& [key, entry] : entries) {
+            result.alive += entry.expired() ? 0 : 1;
+        }
+        return result;
+    }
+
+private:
+    SharedRegistry() = default;
+
+    mutable std::mutex mutex;                                   ///< protects the members below
+    std::unordered_map<std::string, std::weak_ptr<T>> entries;  ///< the loaded objects, expired if freed
+    Stats stats;                                                ///< counters
+};
+
+/// @brief key of a file for a SharedRegistry: the canonical path, size and modification time, so that a changed file
+/// is loaded again. Files that do not exist are identified by the given name
+inline std::string file_identity(const std::string& filename) {
+    std::error_code ec;
+    const auto path{std::filesystem::canonical(filename, ec)};
+    if (ec) {
+        return "missing:" + filename;
+    }
+    std::error_code size_ec, time_ec;
+    const auto size{std::filesystem::file_size(path, size_ec)};
+    const auto time{std::filesystem::last_write_time(path, time_ec)};
+    return "file:" + path.string() + "|" + std::to_string(size_ec ? 0 : size) + "|" +
+           std::to_string(time_ec ? 0 : time.time_since_epoch().count());
+}
+
+/// @brief key of a memory buffer for a SharedRegistry: its size and the fingerprint of its bytes
+inline std::string content_identity(const char* data, const std::size_t length) {
+    const auto fp{FingerprintBuilder{}.add(data, length).result()};
+    return "data:" + std::to_string(length) + "|" + std::to_string(fp.hi) + "|" + std::to_string(fp.lo);
+}
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_SHARED_REGISTRY_H
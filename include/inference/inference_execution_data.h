@@ -11,6 +11,7 @@
 #define VPUNN_INFERENCE_EXECUTION_DATA_H
 
 #include <stdio.h>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -31,11 +32,18 @@ namespace VPUNN {
 /* coverity[rule_of_five_violation:FALSE] */
 class InferenceExecutionData {
 public:
-    InferenceExecutionData(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel)
+    /// @brief allocates the memory for running inferences of a model
+    ///
+    /// @param batch the batch size
+    /// @param theModel the model
+    /// @param with_constants if false the model constants (weights) are not copied here, the model must provide them
+    /// at inference time (see InferenceModel::has_shared_constants)
+    InferenceExecutionData(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel,
+                           const bool with_constants = true)
             : input_buffer_cached_IDX{theModel ? theModel->inputs()->Get(0) : -1},
               output_buffer_cached_IDX{theModel ? theModel->outputs()->Get(0) : -1} {
         if (theModel) {
-            allocate_tensorsMapAndBias(batch, theModel);  // default batch size is 1
+            allocate_tensorsMapAndBias(batch, theModel, with_constants);  // default batch size is 1
             check_in_out_cardinality(theModel);           // check if the model has one input and one output//throws
         }
     }
@@ -82,7 +90,8 @@ protected:
         return vv;
     }
 
-    void allocate_tensorsMapAndBias(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel);
+    void allocate_tensorsMapAndBias(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel,
+                                    const bool with_constants);
 
     friend class InferenceModel;
 
@@ -130,6 +139,15 @@ protected:
     }
 
 public:
+    /// @brief memory of the tensors held here (inputs, inter layer data and the constants if not shared), in bytes
+    std::size_t size_in_bytes() const {
+        std::size_t bytes{0};
+        for (const auto& tensor : tensor_map) {
+            bytes += static_cast<std::size_t>(tensor.size()) * sizeof(float);
+        }
+        return bytes;
+    }
+
     /**
      * @brief Get the model input tensors shapes
      *
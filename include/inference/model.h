@@ -25,6 +25,7 @@
 // #include "kernels/bias.h"
 
 #include "inference/inference_execution_data.h"
+#include "kernels/fully_connected.h"
 #include "vpunn_generated.h"  //for flabuffer model
 
 namespace VPUNN {
@@ -42,9 +43,27 @@ private:
 
     bool initialized;
 
+    /// constant tensors of the model (weights, bias, kNN data), converted once at load time and shared read only by
+    /// all the inferences. Indexed like the model tensors, nullptr for activations and for tensors used only as FC
+    /// weights (these are kept only packed)
+    std::vector<std::unique_ptr<const Tensor<float>>> shared_constants;
+    /// FC layers weights packed for the Dense micro-kernel, indexed like the model operators, nullptr for other layers
+    std::vector<std::unique_ptr<const PackedDenseWeights>> packed_dense;
+    /// precision of the packed FC weights, requested at construction. FP32 if the weights are not packed
+    WeightsPrecision weights_precision{WeightsPrecision::FP32};
+
+    /// prepares the shared constants and packs the FC weights. If the model constants are not consistent nothing is
+    /// shared, the inference data will hold its own copy of the constants (and will report the error)
+    void compile_constants();
+
+    /// the input tensors of a layer, constants are the shared ones
+    std::vector<const Tensor<float>*> layer_inputs(const flatbuffers::Vector<int32_t>* tensors,
+                                                   const InferenceExecutionData& execution_memory) const;
+
     // Run an individual layer, memory passed from outside
     void run_layer(const VPUNN_SCHEMA::Layer* layer, const std::vector<const Tensor<float>*>& inputs,
-                   const std::vector<Tensor<float>*>& outputs, BiasOpBuffer& biasBuf) const;
+                   const std::vector<Tensor<float>*>& outputs, const PackedDenseWeights* packed_weights,
+                   BiasOpBuffer& biasBuf) const;
 
 public:
     const VPUNN_SCHEMA::Model* get_model() const {
@@ -63,16 +82,25 @@ public:
      * @brief Construct a new Inference Model object
      *
      * @param filename .vpunn file
+     * @param precision precision of the FC weights used by the inference, reduced ones are quantized at load
      */
-    explicit InferenceModel(const char* filename);
+    explicit InferenceModel(const char* filename, const WeightsPrecision precision = WeightsPrecision::FP32);
     /**
      * @brief Construct a new Inference Model object
      *
      * @param data a pointer to a const char buffer containing the .vpunn model
      * @param length the data buffer length
      * @param with_copy enable/disable memcopy of the original data buffer
+     * @param precision precision of the FC weights used by the inference, reduced ones are quantized at load
      */
-    InferenceModel(const char* data, size_t length, bool with_copy);
+    InferenceModel(const char* data, size_t length, bool with_copy,
+                   const WeightsPrecision precision = WeightsPrecision::FP32);
+
+    InferenceModel(const InferenceModel&) = delete;             ///< constants are not duplicated
+    InferenceModel& operator=(const InferenceModel&) = delete;  ///< constants are not duplicated
+    InferenceModel(InferenceModel&&) = default;
+    InferenceModel& operator=(InferenceModel&&) = default;
+    ~InferenceModel() = default;
 
     /**
      * @brief Check if the NN model is initialized
@@ -84,6 +112,22 @@ public:
         return initialized;
     }
 
+    /**
+     * @brief Check if the constants of the model are shared by the inferences, so the execution data does not need
+     * to hold them
+     */
+    bool has_shared_constants() const {
+        return !packed_dense.empty();
+    }
+
+    /// @brief precision of the FC weights used by the inference
+    WeightsPrecision get_weights_precision() const noexcept {
+        return weights_precision;
+    }
+
+    /// @brief memory used by the shared constants and the packed FC weights, in bytes
+    std::size_t shared_constants_bytes() const;
+
     /**
      * @brief Run the inference
      *
@@ -0,0 +1,106 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_PRECISION_VALIDATION_H
+#define VPUNN_PRECISION_VALIDATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "inference/vpunn_runtime.h"
+#include "kernels/fully_connected.h"
+
+namespace VPUNN {
+
+/// @brief deviation of the NN outputs obtained with reduced precision weights from the fp32 outputs
+struct PrecisionDeviation {
+    WeightsPrecision precision{WeightsPrecision::FP32};  ///< the precision that was compared with fp32
+    std::size_t samples{0};                              ///< number of compared inputs
+    float max_abs{0.0F};                                 ///< max of |out - out_fp32|
+    float mean_abs{0.0F};                                ///< mean of |out - out_fp32|
+    float max_rel{0.0F};   ///< max of |out - out_fp32| / |out_fp32|, over the non zero fp32 outputs
+    float mean_rel{0.0F};  ///< mean of |out - out_fp32| / |out_fp32|, over the non zero fp32 outputs
+};
+
+inline std::ostream& operator<<(std::ostream& stream, const PrecisionDeviation& d) {
+    stream << to_string(d.precision) << " vs FP32, samples: " << d.samples << ", abs max: " << d.max_abs
+           << ", abs mean: " << d.mean_abs << ", rel max: " << d.max_rel << ", rel mean: " << d.mean_rel;
+    return stream;
+}
+
+/**
+ * @brief Measures how much a reduced precision changes the results of a NN model, to choose the precision per model.
+ *
+ * The model is loaded once in fp32 as reference and once for each compared precision. The inputs are NN descriptors
+ * (e.g. VPUCostModel::getDescriptor of a set of workloads). The first output of each inference is compared, for the
+ * DPU models this is the cycles estimate.
+ */
+class PrecisionValidator {
+public:
+    /// @param filename the .vpunn model
+    explicit PrecisionValidator(const std::string& filename): model_file{filename}, reference{filename} {
+    }
+
+    bool is_initialized() const {
+        return reference.initialized();
+    }
+
+    /// @brief the deviation of the given precision over the descriptors. Empty report if the model is not loaded
+    /// @throws std::runtime_error if a descriptor does not match the model input
+    PrecisionDeviation compare(const WeightsPrecision precision,
+                               const std::vector<std::vector<float>>& descriptors) const {
+        PrecisionDeviation result{};
+        result.precision = precision;
+        if (!is_initialized()) {
+            return result;
+        }
+        const Runtime reduced{model_file, false, precision};
+        auto reference_data{reference.createNewInferenceExecutionData(1)};
+        auto reduced_data{reduced.createNewInferenceExecutionData(1)};
+
+        double sum_abs{0.0};
+        double sum_rel{0.0};
+        std::size_t rel_samples{0};
+        for (const auto& descriptor : descriptors) {
+            const auto size{static_cast<unsigned int>(descriptor.size())};
+            const float expected{reference.predict<float>(descriptor.data(), size, reference_data)[0]};
+            const float actual{reduced.predict<float>(descriptor.data(), size, reduced_data)[0]};
+
+            const float abs_dev{std::abs(actual - expected)};
+            result.max_abs = std::max(result.max_abs, abs_dev);
+            sum_abs += static_cast<double>(abs_dev);
+            if (expected != 0.0F) {
+                const float rel_dev{abs_dev / std::abs(expected)};
+                result.max_rel = std::max(result.max_rel, rel_dev);
+                sum_rel += static_cast<double>(rel_dev);
+                ++rel_samples;
+            }
+            ++result.samples;
+        }
+        if (result.samples > 0) {
+            result.mean_abs = static_cast<float>(sum_abs / static_cast<double>(result.samples));
+        }
+        if (rel_samples > 0) {
+            result.mean_rel = static_cast<float>(sum_rel / static_cast<double>(rel_samples));
+        }
+        return result;
+    }
+
+private:
+    const std::string model_file;  ///< the model, loaded again for each compared precision
+    const Runtime reference;       ///< fp32 model
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_PRECISION_VALIDATION_H
@@ -19,9 +19,14 @@
 #include <vpu/compatibility/types15.h>  // detailed implementations
 #include <vpu/compatibility/types16.h>  //
 #include <vpu/types.h>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>  // for error formating
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "nn_descriptor_versions.h"
@@ -36,46 +41,47 @@ namespace VPUNN {
 class RuntimeProcessingFactory {
 private:
     using PrepropType = Preprocessing<float>;
-    using PreprocessingMap = std::map<int, PrepropType&>;
+    using Creator = std::unique_ptr<PrepropType> (*)();  ///< makes a new preprocessor
+    using CreatorsMap = std::map<int, Creator>;
 
-    // a simple and not optimum (allocates all static)
-    // PreprocessingLatest<float> pp_v00_latest;
-    Preprocessing_Interface01<float> pp_v01_base;
-    Preprocessing_Interface10<float> pp_v10;
-    Preprocessing_Interface11<float> pp_v11;
-    Preprocessing_Interface4011<float> pp_v4011;
-    Preprocessing_Interface4111<float> pp_v4111;
-    Preprocessing_Interface12<float> pp_v12;
-    Preprocessing_Interface13<float> pp_v13;
-    Preprocessing_Interface14<float> pp_v14;
-    Preprocessing_Interface15911<float> pp_v89_11;  // special v159
-    Preprocessing_Interface15<float> pp_v15;
-    Preprocessing_Interface16<float> pp_v16;
+    template <class P>
+    static std::pair<const int, Creator> creator_of() {
+        return {P::getInterfaceVersion(), []() -> std::unique_ptr<PrepropType> {
+                    return std::make_unique<P>();
+                }};
+    }
+
+    /// @brief the map of versions mapped to the makers of the preprocessing concrete objects
+    static const CreatorsMap& creators() {
+        static const CreatorsMap map{
+                // creator_of<PreprocessingLatest<float>>(),
+                creator_of<Preprocessing_Interface01<float>>(),     //
+                creator_of<Preprocessing_Interface10<float>>(),     //
+                creator_of<Preprocessing_Interface11<float>>(),     //
+                creator_of<Preprocessing_Interface15911<float>>(),  // special v159
+                creator_of<Preprocessing_Interface4011<float>>(),   //
+                creator_of<Preprocessing_Interface4111<float>>(),   //
+                creator_of<Preprocessing_Interface12<float>>(),     //
+                creator_of<Preprocessing_Interface13<float>>(),     //
+                creator_of<Preprocessing_Interface14<float>>(),     //
+                creator_of<Preprocessing_Interface15<float>>(),     //
+                creator_of<Preprocessing_Interface16<float>>(),     //
+        };
+        return map;
+    }
 
-    /// @brief the map of versions mapped to preprocessing concrete objects
-    const PreprocessingMap pp_map{
-            //{pp_v00_latest.getInterfaceVersion(), pp_v00_latest},
-            {pp_v01_base.getInterfaceVersion(), pp_v01_base},  //
-            {pp_v10.getInterfaceVersion(), pp_v10},            //
-            {pp_v11.getInterfaceVersion(), pp_v11},            //
-            {pp_v89_11.getInterfaceVersion(), pp_v89_11},      //
-            {pp_v4011.getInterfaceVersion(), pp_v4011},        //
-            {pp_v4111.getInterfaceVersion(), pp_v4111},        //
-            {pp_v12.getInterfaceVersion(), pp_v12},            //
-            {pp_v13.getInterfaceVersion(), pp_v13},            //
-            {pp_v14.getInterfaceVersion(), pp_v14},            //
-            {pp_v15.getInterfaceVersion(), pp_v15},            //
-            {pp_v16.getInterfaceVersion(), pp_v16},            //
-    };
+    mutable std::mutex created_mutex;                             ///< protects created
+    mutable std::map<int, std::unique_ptr<PrepropType>> created;  ///< the preprocessors requested until now
 
 public:
     /// @brief True if a preprocessor exists for required/interrogated version
     bool exists_preprocessing(int input_version) const noexcept {
-        auto found = pp_map.find(input_version);
-        return (found != pp_map.cend());
+        const auto& map{creators()};
+        return (map.find(input_version) != map.cend());
     }
     /** @brief provides a preprocessor for the required interface
-     * The provided preprocessor is owned by this class.
+     * The provided preprocessor is owned by this class. It is created at the first request of its version, the other
+     * versions are not created.
      * For NOW multiple requests for the same version will provide the same object, the factory just shares the
      * preprocessors , does not create a new one for each request
      * @param version desired interface version
@@ -83,8 +89,15 @@ public:
      * @throws out_of_range in case the version is not supported
      */
     Preprocessing<float>& make_preprocessing(int version) const {
-        if (exists_preprocessing(version)) {
-            return pp_map.at(version);
+        const auto& map{creators()};
+        const auto found{map.find(version)};
+        if (found != map.cend()) {
+            std::lock_guard<std::mutex> lock{created_mutex};
+            auto& preprocessing{created[version]};
+            if (!preprocessing) {
+                preprocessing = found->second();
+            }
+            return *preprocessing;
         }
 
         // throw
@@ -93,6 +106,12 @@ public:
         std::string details = buffer.str();
         throw std::out_of_range(details);
     }
+
+    /// @brief how many preprocessors were created until now
+    std::size_t created_count() const {
+        std::lock_guard<std::mutex> lock{created_mutex};
+        return created.size();
+    }
 };
 
 }  // namespace VPUNN
@@ -12,8 +12,10 @@
 
 ///@todo: proposal to rename file into runtime_nn
 
+#include <memory>
 #include <string>
 #include "core/profiling.h"
+#include "core/shared_registry.h"
 #include "inference/inference_execution_data.h"
 #include "inference/model.h"
 #include "inference/model_version.h"
@@ -41,9 +43,11 @@ public:
      * @param filename .vpunn model
      * @param batch model batch size
      * @param profile enable/disable profiling
+     * @param precision precision of the FC weights, reduced precision is faster but approximates the fp32 results
      */
-    explicit Runtime(const std::string& filename, bool profile = false)
-            : model(filename.c_str()),
+    explicit Runtime(const std::string& filename, bool profile = false,
+                     const WeightsPrecision precision = WeightsPrecision::FP32)
+            : model(filename.c_str(), precision),
               // model_buffer_data(createNewInferenceExecutionData(batch)),
               profile(profile),
               model_version() {
@@ -70,9 +74,11 @@ public:
      * @param copy_model_data enable/disable memcopy of the module buffer
      * @param batch model batch size
      * @param profile enable/disable profiling
+     * @param precision precision of the FC weights, reduced precision is faster but approximates the fp32 results
      */
-    explicit Runtime(const char* model_data, size_t model_data_length, bool copy_model_data, bool profile = false)
-            : model(model_data, model_data_length, copy_model_data),
+    explicit Runtime(const char* model_data, size_t model_data_length, bool copy_model_data, bool profile = false,
+                     const WeightsPrecision precision = WeightsPrecision::FP32)
+            : model(model_data, model_data_length, copy_model_data, precision),
               // model_buffer_data(createNewInferenceExecutionData(batch)),
               profile(profile),
               model_version() {
@@ -91,8 +97,14 @@ public:
         return model.is_initialized();
     }
 
+    /// @brief precision of the FC weights used by the inference, FP32 if the requested one could not be applied
+    WeightsPrecision weights_precision() const {
+        return model.get_weights_precision();
+    }
+
     InferenceExecutionData createNewInferenceExecutionData(const unsigned int batch) const {
-        return InferenceExecutionData(batch, model.get_model());  // RVO
+        // the constants are kept once, by the model
+        return InferenceExecutionData(batch, model.get_model(), !model.has_shared_constants());  // RVO
     }
 
 private:
@@ -231,6 +243,37 @@ public:
     }
 };
 
+/**
+ * @brief the Runtime of a .vpunn file, shared (read only) by all the cost providers that load the same file with the
+ * same options. @sa SharedRegistry. The file is loaded only if no provider holds it already.
+ */
+inline std::shared_ptr<const Runtime> load_shared_runtime(const std::string& filename, bool profile = false,
+                                                          const WeightsPrecision precision = WeightsPrecision::FP32) {
+    const std::string key{file_identity(filename) + "|profile:" + std::to_string(profile) +
+                          "|precision:" + std::to_string(static_cast<int>(precision))};
+    return SharedRegistry<const Runtime>::instance().get(key, [&]() {
+        return std::make_shared<const Runtime>(filename, profile, precision);
+    });
+}
+
+/**
+ * @brief the Runtime of a .vpunn buffer, shared (read only) by all the cost providers that load the same content with
+ * the same options. Only a copied buffer is shared, a not copied one stays in use by its Runtime and has the lifetime
+ * chosen by its owner.
+ */
+inline std::shared_ptr<const Runtime> load_shared_runtime(const char* model_data, size_t model_data_length,
+                                                          bool copy_model_data, bool profile = false,
+                                                          const WeightsPrecision precision = WeightsPrecision::FP32) {
+    if (!copy_model_data || model_data == nullptr) {
+        return std::make_shared<const Runtime>(model_data, model_data_length, copy_model_data, profile, precision);
+    }
+    const std::string key{content_identity(model_data, model_data_length) + "|profile:" + std::to_string(profile) +
+                          "|precision:" + std::to_string(static_cast<int>(precision))};
+    return SharedRegistry<const Runtime>::instance().get(key, [&]() {
+        return std::make_shared<const Runtime>(model_data, model_data_length, copy_model_data, profile, precision);
+    });
+}
+
 }  // namespace VPUNN
 
 #endif  // VPUNN_H
@@ -10,6 +10,13 @@
 #ifndef KERNELS_FC_H
 #define KERNELS_FC_H
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <vector>
+
 #include "core/tensors.h"
 
 namespace VPUNN {
@@ -24,6 +31,120 @@ namespace VPUNN {
 VPUNN_API void Dense(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float>* activations,
                      VPUNN::Tensor<float>* output);
 
+/// @brief storage precision of the packed FC weights. Activations and accumulation are always fp32
+enum class WeightsPrecision : int {
+    FP32 = 0,  ///< weights as in the model, exact
+    BF16 = 1,  ///< bfloat16, rounded to nearest even
+    INT8 = 2,  ///< symmetric int8, one fp32 scale per output channel and group of input channels
+};
+
+/// @brief text of a precision, as accepted by weights_precision_from_string
+VPUNN_API std::string_view to_string(const WeightsPrecision precision);
+
+/// @brief precision from its text ("FP32", "BF16", "INT8"), FP32 if the text is not known
+VPUNN_API WeightsPrecision weights_precision_from_string(std::string_view text);
+
+/**
+ * @brief Weights of a FC layer packed for the Dense micro-kernel.
+ *
+ * The [output_channels, input_channels] weights matrix is stored transposed, in panels of panel_width output
+ * channels: a panel holds, for each input channel, the weights of its panel_width outputs contiguously. The last panel
+ * is padded with zeros. The memory is aligned to cache line. Packing is done once (model load), afterwards the object
+ * is read only and can be shared by any number of inferences running in parallel.
+ *
+ * With a reduced precision the panels hold the bf16 or int8 weights instead (the fp32 panels are not kept). For int8
+ * each output channel has a scale for every int8_group_size consecutive input channels: the NN inputs have very
+ * different ranges and a single scale per output channel loses the small weights.
+ */
+class VPUNN_API PackedDenseWeights {
+public:
+    static constexpr int panel_width{8};                ///< output channels in a panel
+    static constexpr std::size_t alignment_bytes{64U};  ///< alignment of the packed data
+    static constexpr int int8_group_size{8};            ///< input channels sharing an int8 scale
+
+    /// @brief packs the weights, output_channels rows of input_channels elements (the layout Dense uses). The
+    /// dimensions are given by the layer activations, the shape of the weights tensor is not used
+    /// @throws std::runtime_error if the weights do not have output_channels x input_channels elements
+    PackedDenseWeights(const VPUNN::Tensor<float>& weights, const int output_channels, const int input_channels,
+                       const WeightsPrecision precision = WeightsPrecision::FP32);
+
+    int output_channels() const noexcept {
+        return n_outputs;
+    }
+    int input_channels() const noexcept {
+        return n_inputs;
+    }
+    int panels() const noexcept {
+        return (n_outputs + panel_width - 1) / panel_width;
+    }
+    WeightsPrecision precision() const noexcept {
+        return weights_precision;
+    }
+    /// @brief first element of a panel, input_channels x panel_width elements. FP32 only, nullptr otherwise
+    const float* panel(const int idx) const noexcept {
+        return data ? data.get() + panel_offset(idx) : nullptr;
+    }
+    /// @brief first element of a panel, as bfloat16 bits. BF16 only, nullptr otherwise
+    const std::uint16_t* panel_bf16(const int idx) const noexcept {
+        return data_bf16 ? data_bf16.get() + panel_offset(idx) : nullptr;
+    }
+    /// @brief first element of a panel. INT8 only, nullptr otherwise
+    const std::int8_t* panel_int8(const int idx) const noexcept {
+        return data_int8 ? data_int8.get() + panel_offset(idx) : nullptr;
+    }
+    /// @brief number of groups of input channels sharing an int8 scale
+    int int8_groups() const noexcept {
+        return (n_inputs + int8_group_size - 1) / int8_group_size;
+    }
+    /// @brief the dequantization scales of a panel, int8_groups() x panel_width. INT8 only, nullptr otherwise
+    const float* panel_scales(const int idx) const noexcept {
+        return scales.empty() ? nullptr : scales.data() + static_cast<std::size_t>(idx) * int8_groups() * panel_width;
+    }
+    /// @brief memory used by the packed weights
+    std::size_t size_in_bytes() const noexcept {
+        const std::size_t elements{static_cast<std::size_t>(panels()) * n_inputs * panel_width};
+        switch (weights_precision) {
+        case WeightsPrecision::BF16:
+            return elements * sizeof(std::uint16_t);
+        case WeightsPrecision::INT8:
+            return elements * sizeof(std::int8_t) + scales.size() * sizeof(float);
+        default:
+            return elements * sizeof(float);
+        }
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(void* ptr) const noexcept {
+            ::operator delete[](ptr, std::align_val_t{alignment_bytes});
+        }
+    };
+
+    std::size_t panel_offset(const int idx) const noexcept {
+        return static_cast<std::size_t>(idx) * n_inputs * panel_width;
+    }
+
+    int n_outputs;                                               ///< output channels
+    int n_inputs;                                                ///< input channels
+    WeightsPrecision weights_precision;                          ///< which of the panels below are present
+    std::unique_ptr<float[], AlignedDelete> data;                ///< the panels, FP32
+    std::unique_ptr<std::uint16_t[], AlignedDelete> data_bf16;  ///< the panels, BF16
+    std::unique_ptr<std::int8_t[], AlignedDelete> data_int8;    ///< the panels, INT8
+    std::vector<float> scales;                                   ///< scales of each panel, INT8
+};
+
+/**
+ * @brief Floating point FC layer (float) with packed weights, optionally with the bias added
+ * Same result as Dense(weights) followed by a BiasOp for FP32 weights, an approximation of it for reduced precision
+ *
+ * @param weights the packed FC layer weights
+ * @param activations the input tensor [batch, input_channels]
+ * @param output the output tensor [batch, output_channels]
+ * @param bias a tensor with output_channels elements, nullptr if no bias
+ */
+VPUNN_API void Dense(const PackedDenseWeights& weights, const VPUNN::Tensor<float>* activations,
+                     VPUNN::Tensor<float>* output, const VPUNN::Tensor<float>* bias = nullptr);
+
 }  // namespace VPUNN
 
 #endif  // KERNELS_FC_H
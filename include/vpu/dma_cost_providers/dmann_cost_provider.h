@@ -25,6 +25,7 @@
 #include <shared_mutex>
 
 #include "vpu/nn_cost_provider_execution_context.h"
+#include "vpu/nn_execution_context_pool.h"
 #include "vpu/serialization/dma_cost_serialization_wrapper.h"
 
 namespace VPUNN {
@@ -34,7 +35,7 @@ public:
     DMANNCostProvider(const std::string& filename = "",
                    const unsigned int batch_size = 1, bool profile = false, const unsigned int cache_size = 16384,
                    const std::string& dma_cache_filename = "", bool tryToLoadPairedCache = false)
-            : vpunn_runtime(filename, profile),
+            : shared_runtime(load_shared_runtime(filename, profile)),
               preprocessing_factory{},
               postprocessing_factory{},
               preprocessing(init_preproc(preprocessing_factory, vpunn_runtime.model_version_info(), filename)),
@@ -59,7 +60,7 @@ public:
                    bool copy_model_data, bool profile = false,
                    const unsigned int cache_size = 16384, const char* dma_cache_data = nullptr,
                    size_t dma_cache_data_length = 0)
-            : vpunn_runtime(model_data, model_data_length, copy_model_data, profile),
+            : shared_runtime(load_shared_runtime(model_data, model_data_length, copy_model_data, profile)),
               preprocessing_factory{},
               postprocessing_factory{},
               preprocessing(init_preproc(preprocessing_factory, vpunn_runtime.model_version_info(), "")),
@@ -229,38 +230,23 @@ public:
         return cycles_vector;  // RVO
     }
 
-    /// provides the context or creates a new one in case it does not exist yet
+    /// provides the context of the calling thread, leased from the pool at the first call of the thread
     /// the context containers are (must be ) mutable
     NNExecutionContext& get_execution_context() const {
-        const auto thread_id = std::this_thread::get_id();
+        return contexts->get();
+    }
 
-        // First, try to find the context with a shared (read) lock
-        {
-            std::shared_lock<std::shared_mutex> read_lock(context_map_mutex);
-            auto it = context_map.find(thread_id);
-            if (it != context_map.end()) {
-                return *(it->second);
-            }
-        }
+public:
+    /// @brief statistics of the execution contexts (inference buffers), one for each thread using the provider
+    NNExecutionContextPool::Stats get_execution_context_stats() const {
+        return contexts->get_stats();
+    }
 
-        // If not found, acquire an exclusive (write) lock to insert
-        {
-            std::unique_lock<std::shared_mutex> write_lock(context_map_mutex);
-            // Double-check in case another thread inserted in the meantime
-            auto it = context_map.find(thread_id);
-            if (it == context_map.end()) {
-                it = context_map
-                             .emplace(thread_id,  // key
-                                      std::make_shared<NNExecutionContext>(
-                                              vpunn_runtime.createNewInferenceExecutionData(batch_size))  // context
-                                      )
-                             .first;
-            }
-            return *(it->second);
-        }
+    /// @brief max number of contexts of ended threads kept for new threads, the others are freed
+    void set_max_pooled_execution_contexts(const std::size_t max_pooled) const {
+        contexts->set_max_pooled(max_pooled);
     }
 
-public:
     CyclesInterfaceType get_cost(const WlT& workload, std::string* cost_source = nullptr) const override {
         if (!is_initialized()) {
             return Cycles::ERROR_INFERENCE_NOT_POSSIBLE;
@@ -340,7 +326,9 @@ public:
     }
 
 private:
-    const Runtime vpunn_runtime;  ///< the loaded inference model is here, used for FW propagation
+    const std::shared_ptr<const Runtime> shared_runtime;  ///< the loaded inference model, shared by the providers of
+                                                          ///< the same model, @sa load_shared_runtime
+    const Runtime& vpunn_runtime{*shared_runtime};        ///< the loaded inference model, used for FW propagation
     const DMARuntimeProcessingFactory<WlT> preprocessing_factory;  ///< provides Preprocessing objects
     const DMAPostProcessingFactory<WlT> postprocessing_factory;
     const IPreprocessingDMA<float, WlT>& preprocessing;  ///< prepares the input vector for the runtime, configured at ctor
@@ -353,9 +341,10 @@ private:
     const std::string model_nickname{make_model_nickname()};  ///< nickname for the model, used for cache and serializer
     const float default_NN_output{-1.0F};     ///< this is the value used in no NN output is present (like not loaded).
     const unsigned int batch_size{1};         ///< the batch size used for the inference, set at ctor, used for context
-    // Map of (thread ID, instance ID) to execution contexts
-    mutable std::map<std::thread::id, std::shared_ptr<NNExecutionContext>> context_map;
-    mutable std::shared_mutex context_map_mutex;  ///< Mutex to protect the context map
+    /// execution contexts of the threads using this provider, returned to the pool when the threads end
+    const std::shared_ptr<NNExecutionContextPool> contexts{NNExecutionContextPool::make([this]() {
+        return std::make_unique<NNExecutionContext>(vpunn_runtime.createNewInferenceExecutionData(batch_size));
+    })};
 private:
     /// @brief obtains the actual preprocessing instance from factory. The factory must live longer than the instance
     /// created. warning: Throws if not possible
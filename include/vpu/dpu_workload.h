@@ -16,6 +16,7 @@
 #include <optional>
 #include <string>
 
+#include "core/fingerprint.h"
 #include "dpu_defaults.h"
 #include "dpu_halo.h"
 #include "dpu_types.h"
@@ -286,6 +287,18 @@ public:
     /// Uses the same fnv1a_hash function as NNDescriptor, but without preprocessing
     uint32_t hash() const noexcept;
 
+    /// 128 bit digest of the fields compared by operator== (the ones of hash() plus the layer info), for the
+    /// fingerprint mode of the dynamic cache. Sparsity is considered with the precision of operator== instead of
+    /// hash()'s percents
+    Fingerprint128 fingerprint() const noexcept;
+
+private:
+    /// digests the fields of hash() into h, an uint32_t FNV-1a state or a FingerprintBuilder
+    template <typename H>
+    H hash_fields(H h) const noexcept;
+
+public:
+
     DPUWorkload(const DPUWorkload&) = default;
     DPUWorkload& operator=(const DPUWorkload&) = default;
     DPUWorkload() = default;
@@ -10,8 +10,10 @@
 #ifndef ENERGY_INTERFACE_H
 #define ENERGY_INTERFACE_H
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "vpu/dpu_info_pack.h"
 #include "vpu/power.h"
@@ -67,6 +69,19 @@ public:
         return calculateEnergyFromIdealCycles(wl, performance.DPU_Power_IdealCycles(wl));
     }
 
+    /**
+     * @brief Compute the energy of multiple DPUWorkloads, same as DPUEnergy for each one.
+     * @param workloads a std::vector of DPUWorkload
+     * @return the energy of each workload, in the same order, measured  PowerVirus*cycle
+     */
+    std::vector<float> DPUEnergy(const std::vector<DPUWorkload>& workloads) const {
+        std::vector<float> energies(workloads.size());
+        std::transform(workloads.cbegin(), workloads.cend(), energies.begin(), [this](const DPUWorkload& wl) {
+            return calculateEnergyFromIdealCycles(wl, performance.DPU_Power_IdealCycles(wl));
+        });
+        return energies;
+    }
+
     /** @brief Compute the energy of a SHAVE SHAVEWorkload.
      * @details Energy here is a relative metric, but the activity factor of the operation multiplied by
      *          its cost (number of clock cycles). We assume a constant activity factor of 0.5 for all and a max
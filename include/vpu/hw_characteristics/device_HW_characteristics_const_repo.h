@@ -104,6 +104,13 @@ public:
         return IndexMap::extract_tuple_content<DeviceHWCharacteristicsVariant>(device, const_HW_characteristics_);
     }
 };
+
+/// the type of the active HW characteristics of a device known at compile time, its values are constexpr
+template <VPUDevice device>
+using HWCharacteristicsOf =
+        std::variant_alternative_t<DeviceHWCHaracteristicsConstRepo::get_HWCharacteristics(device).index(),
+                                   DeviceHWCharacteristicsVariant>;
+
 }  // namespace VPUNN
 
 #endif  //
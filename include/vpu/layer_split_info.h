@@ -43,10 +43,18 @@ using DPUWorkloadsCost = std::pair<CyclesInterfaceType, DPUWorkloads>;  ///> int
 struct DPUWorkloadsWithCyclesSplit {
     std::vector<CyclesInterfaceType> cycles{};
     std::vector<DPUWorkload> workloads{};
+    std::vector<float> energy{};  ///< energy of each workload, empty if energy was not computed
 };
 
 using DPUWorkloadsWithCycleCost = std::pair<CyclesInterfaceType, DPUWorkloadsWithCyclesSplit>;  ///>internal
 
+/// a split described by both its runtime and its energy. Element of a Pareto front of splits
+struct DPUWorkloadsPnP {
+    CyclesInterfaceType cycles{Cycles::NO_ERROR};  ///< runtime of the workloads on the tile
+    float energy{0.0f};                            ///< energy of all the workloads, measured  PowerVirus*cycle
+    DPUWorkloads workloads{};
+};
+
 /// details about a tile split strategy
 struct OneTileLayerInfo {
     DPULayer inter_tile_split_layer{};  ///<  layer resulted by splitting the orginalLayer to one tile using requested
@@ -22,8 +22,9 @@
 #include <thread>
 #include "core/cache.h"
 #include "core/dpu_map_type_selector.h"
-#include "core/logger.h"  // for Logger::error()
-#include "core/utils.h"   // for get_env_vars()
+#include "core/logger.h"     // for Logger::error()
+#include "core/profiling.h"  // for PhaseTimes
+#include "core/utils.h"      // for get_env_vars()
 #include "inference/post_process.h"
 #include "inference/postprocessing_factory.h"
 #include "inference/preprocessing.h"
@@ -31,6 +32,8 @@
 #include "inference/vpunn_runtime.h"
 #include "vpu/cycles_interface_types.h"
 #include "vpu/nn_cost_provider_execution_context.h"
+#include "vpu/nn_execution_context_pool.h"
+#include "vpu/nn_micro_batcher.h"
 #include "vpu/serialization/l1_cost_serialization_wrapper.h"
 #include "vpu/types.h"  // for DPUWorkload, VPUDevice
 
@@ -41,52 +44,78 @@ public:
     NNCostProvider(const std::string& filename = "", const unsigned int batch_size = 1, bool profile = false,
                    const unsigned int cache_size = 16384, const std::string& dpu_cache_filename = "",
                    bool tryToLoadPairedCache = false)
-            : vpunn_runtime(filename, profile),
+            : shared_runtime(startup_times.measure("runtime",
+                                                   [&]() {
+                                                       return load_shared_runtime(filename, profile,
+                                                                                  init_weights_precision());
+                                                   })),
               preprocessing_factory{},
               postprocessing_factory{},
-              preprocessing(init_preproc(preprocessing_factory, vpunn_runtime.model_version_info(), filename)),
+              preprocessing(startup_times.measure("preprocessing",
+                                                  [&]() -> Preprocessing<float>& {
+                                                      return init_preproc(preprocessing_factory,
+                                                                          vpunn_runtime.model_version_info(), filename);
+                                                  })),
               results_config(vpunn_runtime.model_version_info().get_output_interface_version()),
               post_processing(init_postproc(postprocessing_factory, vpunn_runtime.model_version_info(), filename)),
-              cache(cache_size /*, preprocessing.output_size()*/, dpu_cache_filename,
-                    (tryToLoadPairedCache ? filename : "")),
-              new_cache(cache_size, dpu_cache_filename,
-                        (tryToLoadPairedCache ? filename : "")),  // New cache for newer devices
+              cache(startup_times.measure("cache",
+                                          [&]() {
+                                              return LRUCache<std::vector<float>, float>(
+                                                      cache_size /*, preprocessing.output_size()*/, dpu_cache_filename,
+                                                      (tryToLoadPairedCache ? filename : ""));
+                                          })),
+              new_cache(startup_times.measure("new_cache",
+                                              [&]() {
+                                                  return LRUCache<DPUWorkload, float>(
+                                                          cache_size, dpu_cache_filename,
+                                                          (tryToLoadPairedCache ? filename : ""));
+                                              })),  // New cache for newer devices
               cache_miss_serializer(get_env_vars({"ENABLE_VPUNN_CACHE_MISS_DATA_SERIALIZATION"})
                                             .at("ENABLE_VPUNN_CACHE_MISS_DATA_SERIALIZATION") == "TRUE"),
               batch_size(batch_size) {
-        if (!is_initialized()) {
-            return;
-        }
-
-        check_post_config(vpunn_runtime.model_version_info());
-        correlate_preprocessor_with_model_inputs();
-        cache_miss_serializer.initialize(cache_miss_file_naming(), FileMode::READ_WRITE, get_names_for_serializer());
+        finish_startup();
     };
 
     NNCostProvider(const char* model_data, size_t model_data_length, const unsigned int batch_size,
                    bool copy_model_data, bool profile = false, const unsigned int cache_size = 16384,
                    const char* dpu_cache_data = nullptr, size_t dpu_cache_data_length = 0)
-            : vpunn_runtime(model_data, model_data_length, copy_model_data, profile),
+            : shared_runtime(startup_times.measure("runtime",
+                                                   [&]() {
+                                                       return load_shared_runtime(model_data, model_data_length,
+                                                                                  copy_model_data, profile,
+                                                                                  init_weights_precision());
+                                                   })),
               preprocessing_factory{},
               postprocessing_factory{},
-              preprocessing(init_preproc(preprocessing_factory, vpunn_runtime.model_version_info(), "")),
+              preprocessing(startup_times.measure("preprocessing",
+                                                  [&]() -> Preprocessing<float>& {
+                                                      return init_preproc(preprocessing_factory,
+                                                                          vpunn_runtime.model_version_info(), "");
+                                                  })),
               results_config(vpunn_runtime.model_version_info().get_output_interface_version()),
               post_processing(init_postproc(postprocessing_factory, vpunn_runtime.model_version_info(), "")),
-              cache(cache_size, /* preprocessing.output_size(),*/ dpu_cache_data, dpu_cache_data_length),
-              new_cache(cache_size, dpu_cache_data,
-                        dpu_cache_data_length),  // New cache for newer devices
+              cache(startup_times.measure("cache",
+                                          [&]() {
+                                              return LRUCache<std::vector<float>, float>(
+                                                      cache_size, /* preprocessing.output_size(),*/ dpu_cache_data,
+                                                      dpu_cache_data_length);
+                                          })),
+              new_cache(startup_times.measure("new_cache",
+                                              [&]() {
+                                                  return LRUCache<DPUWorkload, float>(cache_size, dpu_cache_data,
+                                                                                      dpu_cache_data_length);
+                                              })),  // New cache for newer devices
               cache_miss_serializer(get_env_vars({"ENABLE_VPUNN_CACHE_MISS_DATA_SERIALIZATION"})
                                             .at("ENABLE_VPUNN_CACHE_MISS_DATA_SERIALIZATION") == "TRUE"),
               batch_size(batch_size) {
-        if (!is_initialized()) {
-            return;
-        }
-
-        check_post_config(vpunn_runtime.model_version_info());
-        correlate_preprocessor_with_model_inputs();
-        cache_miss_serializer.initialize(cache_miss_file_naming(), FileMode::READ_WRITE, get_names_for_serializer());
+        finish_startup();
     };
 
+    /// @brief durations of the construction phases of this provider, also reported through the logger (info level)
+    const PhaseTimes& get_startup_times() const noexcept {
+        return startup_times;
+    }
+
     const std::string cache_miss_file_naming() const {
         return "cache_misses";
     }
@@ -104,6 +133,26 @@ public:
                        : new_cache.getPreloadedCacheCounter();
     }
 
+    /**
+     * @brief Groups the single workload inferences (cache misses) that concurrent threads request into batched
+     * inferences. Helps when many threads ask for single workloads at the same time, slows down a single thread by the
+     * batching window for each cache miss. The workloads vector inference is not affected.
+     * Is const like the caches. Must not be called while inferences are running.
+     *
+     * @param config the batching parameters, nullopt disables the batching
+     */
+    void set_micro_batching(const std::optional<MicroBatchingConfig>& config) const {
+        micro_batcher.reset();
+        if (config && is_initialized()) {
+            micro_batcher = std::make_unique<NNMicroBatcher>(vpunn_runtime, preprocessing.output_size(), *config);
+        }
+    }
+
+    /// @brief statistics of the micro batching, nullopt if it is not enabled
+    std::optional<NNMicroBatcher::Stats> get_micro_batching_stats() const {
+        return micro_batcher ? std::optional<NNMicroBatcher::Stats>{micro_batcher->get_stats()} : std::nullopt;
+    }
+
     /// @brief provides the nickname of the model, used for cache and serializer
     /// @returns the nickname of the model
     std::string get_model_nickname() const noexcept {
@@ -126,7 +175,9 @@ protected:
 
         // Helper lambdas for cache access and update
         auto compute_and_cache = [&](auto& cache_ref, auto&& key, const std::vector<float>& descriptor) -> float {
-            const auto infered_value = vpunn_runtime.predict<float>(descriptor, ctx.runtime_buffer_data)[0];
+            const auto infered_value =
+                    micro_batcher ? micro_batcher->infer(descriptor)
+                                  : vpunn_runtime.predict<float>(descriptor, ctx.runtime_buffer_data)[0];
             cache_ref.add(key, infered_value);
 
             L1CostSerializationWrap serialization_handler(cache_miss_serializer);
@@ -229,38 +280,23 @@ protected:
         return cycles_vector;  // RVO
     }
 
-    /// provides the context or creates a new one in case it does not exist yet
+    /// provides the context of the calling thread, leased from the pool at the first call of the thread
     /// the context containers are (must be ) mutable
     NNExecutionContext& get_execution_context() const {
-        const auto thread_id = std::this_thread::get_id();
-
-        // First, try to find the context with a shared (read) lock
-        {
-            std::shared_lock<std::shared_mutex> read_lock(context_map_mutex);
-            auto it = context_map.find(thread_id);
-            if (it != context_map.end()) {
-                return *(it->second);
-            }
-        }
-
-        // If not found, acquire an exclusive (write) lock to insert
-        {
-            std::unique_lock<std::shared_mutex> write_lock(context_map_mutex);
-            // Double-check in case another thread inserted in the meantime
-            auto it = context_map.find(thread_id);
-            if (it == context_map.end()) {
-                it = context_map
-                             .emplace(thread_id,  // key
-                                      std::make_shared<NNExecutionContext>(
-                                              vpunn_runtime.createNewInferenceExecutionData(batch_size))  // context
-                                      )
-                             .first;
-            }
-            return *(it->second);
-        }
+        return contexts->get();
     }
 
 public:
+    /// @brief statistics of the execution contexts (inference buffers), one for each thread using the provider
+    NNExecutionContextPool::Stats get_execution_context_stats() const {
+        return contexts->get_stats();
+    }
+
+    /// @brief max number of contexts of ended threads kept for new threads, the others are freed
+    void set_max_pooled_execution_contexts(const std::size_t max_pooled) const {
+        contexts->set_max_pooled(max_pooled);
+    }
+
     CyclesInterfaceType get_cost(const DPUWorkload& workload) const {
         if (!is_initialized()) {
             return Cycles::ERROR_INFERENCE_NOT_POSSIBLE;
@@ -364,7 +400,10 @@ public:
     }
 
 private:
-    const Runtime vpunn_runtime;  ///< the loaded inference model is here, used for FW propagation
+    PhaseTimes startup_times;  ///< the construction phases, must be initialized before the members it measures
+    const std::shared_ptr<const Runtime> shared_runtime;  ///< the loaded inference model, shared by the providers of
+                                                          ///< the same model, @sa load_shared_runtime
+    const Runtime& vpunn_runtime{*shared_runtime};        ///< the loaded inference model, used for FW propagation
     const RuntimeProcessingFactory preprocessing_factory;
     const PostProcessingFactory postprocessing_factory;
     const Preprocessing<float>& preprocessing;  ///< prepares the input vector for the runtime, configured at ctor
@@ -379,10 +418,37 @@ private:
     const float default_NN_output{-1.0F};  ///< this is the value used in no NN output is present (like not loaded).
     const unsigned int batch_size{1};      ///< the batch size used for the inference, set at ctor, used for context
 
-    // Map of (thread ID, instance ID) to execution contexts
-    mutable std::map<std::thread::id, std::shared_ptr<NNExecutionContext>> context_map;
-    mutable std::shared_mutex context_map_mutex;  ///< Mutex to protect the context map
+    mutable std::unique_ptr<NNMicroBatcher> micro_batcher;  ///< groups concurrent single inferences, if enabled
+
+    /// execution contexts of the threads using this provider, returned to the pool when the threads end
+    const std::shared_ptr<NNExecutionContextPool> contexts{NNExecutionContextPool::make([this]() {
+        return std::make_unique<NNExecutionContext>(vpunn_runtime.createNewInferenceExecutionData(batch_size));
+    })};
 private:
+    /// @brief the last construction steps, with the startup timing breakdown report
+    void finish_startup() {
+        if (is_initialized()) {
+            startup_times.measure("checks", [this]() {
+                check_post_config(vpunn_runtime.model_version_info());
+                correlate_preprocessor_with_model_inputs();
+            });
+            startup_times.measure("serializer", [this]() {
+                cache_miss_serializer.initialize(cache_miss_file_naming(), FileMode::READ_WRITE,
+                                                 get_names_for_serializer());
+            });
+        }
+        if (Logger::level() >= LogLevel::Info) {
+            Logger::info() << "NN cost provider startup (" << model_nickname << "): " << startup_times.to_string();
+        }
+    }
+
+    /// @brief precision of the NN weights, opt-in reduced precision from VPUNN_INFERENCE_PRECISION (FP32, BF16, INT8).
+    /// The default is FP32
+    static WeightsPrecision init_weights_precision() {
+        return weights_precision_from_string(
+                get_env_vars({"VPUNN_INFERENCE_PRECISION"}).at("VPUNN_INFERENCE_PRECISION"));
+    }
+
     /// @brief obtains the actual preprocessing instance from factory. The factory must live longer than the instance
     /// created. warning: Throws if not possible
     static Preprocessing<float>& init_preproc(const RuntimeProcessingFactory& factory,
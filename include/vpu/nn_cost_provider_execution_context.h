@@ -23,7 +23,7 @@ struct NNExecutionContext {
     InferenceExecutionData runtime_buffer_data;   ///< buffer data for the inference execution
     std::vector<float> workloads_results_buffer;  ///< buffer for the results of the BATCH inference
 
-    const std::thread::id thread_id;                        ///< thread id for the context
+    const std::thread::id thread_id;  ///< thread that created the context, a pooled context is reused by others
     static inline constexpr size_t prealloc_results{1000};  ///< how much results buffer to pre-alloc
 
     explicit NNExecutionContext(InferenceExecutionData&& execution_data_specific)
@@ -32,6 +32,11 @@ struct NNExecutionContext {
               thread_id(std::this_thread::get_id()) {
         workloads_results_buffer.reserve(prealloc_results);  // reserve space for the results
     };
+
+    /// @brief memory of the buffers, in bytes
+    size_t size_in_bytes() const {
+        return runtime_buffer_data.size_in_bytes() + workloads_results_buffer.capacity() * sizeof(float);
+    }
 };
 
 }  // namespace VPUNN
@@ -0,0 +1,173 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef NN_EXECUTION_CONTEXT_POOL_H_
+#define NN_EXECUTION_CONTEXT_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "vpu/nn_cost_provider_execution_context.h"
+
+namespace VPUNN {
+
+class NNExecutionContextPool;
+
+namespace detail {
+/// a context a thread took from a pool, with the pool it has to be returned to
+struct ContextLease {
+    const NNExecutionContextPool* pool;           ///< identity of the pool, valid only if owner is not expired
+    std::weak_ptr<NNExecutionContextPool> owner;  ///< the pool, if still alive
+    std::unique_ptr<NNExecutionContext> context;  ///< the leased context
+};
+
+/// the contexts leased by the current thread, returned to their pools when the thread ends
+struct ThreadContextLeases {
+    std::vector<ContextLease> leases;
+    ~ThreadContextLeases();
+};
+
+inline ThreadContextLeases& thread_context_leases() {
+    thread_local ThreadContextLeases leases;
+    return leases;
+}
+}  // namespace detail
+
+/**
+ * @brief The execution contexts (inference buffers) of a NN cost provider, one per thread that uses the provider.
+ *
+ * The first inference of a thread leases a context from the pool, later ones find it in a thread local list without
+ * any lock. When the thread ends its context returns to the pool and is reused by a new thread. At most max_pooled
+ * idle contexts are kept, the others are freed, so the memory follows the number of live threads and not the number
+ * of threads that ever used the provider. A context leased by a thread outlives the pool if the thread does.
+ */
+class NNExecutionContextPool : public std::enable_shared_from_this<NNExecutionContextPool> {
+public:
+    using Factory = std::function<std::unique_ptr<NNExecutionContext>()>;  ///< creates a new context
+
+    static constexpr std::size_t default_max_pooled{8U};  ///< idle contexts kept by default
+
+    /// @brief statistics since creation
+    struct Stats {
+        std::size_t created{0};    ///< contexts created
+        std::size_t reused{0};     ///< leases served with an idle context
+        std::size_t released{0};   ///< contexts returned by ended threads
+        std::size_t discarded{0};  ///< idle contexts freed because the pool was full
+        std::size_t in_use{0};     ///< contexts leased to threads now
+        std::size_t pooled{0};     ///< idle contexts kept now
+        std::size_t bytes{0};      ///< memory of the contexts in use and pooled
+    };
+
+    /// @brief the pool must be owned by a shared_ptr, the threads keep a weak reference to it
+    static std::shared_ptr<NNExecutionContextPool> make(Factory factory,
+                                                        const std::size_t max_pooled = default_max_pooled) {
+        return std::shared_ptr<NNExecutionContextPool>(new NNExecutionContextPool(std::move(factory), max_pooled));
+    }
+
+    NNExecutionContextPool(const NNExecutionContextPool&) = delete;
+    NNExecutionContextPool& operator=(const NNExecutionContextPool&) = delete;
+
+    /// @brief the context of the calling thread, leased at its first call
+    NNExecutionContext& get() {
+        auto& leases{detail::thread_context_leases().leases};
+        for (auto& lease : leases) {
+            if (lease.pool == this && !lease.owner.expired()) {
+                return *lease.context;
+            }
+        }
+        // leases of destroyed pools are dropped, another pool may now have the same address
+        leases.erase(std::remove_if(leases.begin(), leases.end(),
+                                    [](const detail::ContextLease& lease) {
+                                        return lease.owner.expired();
+                                    }),
+                     leases.end());
+        leases.push_back({this, weak_from_this(), acquire()});
+        return *leases.back().context;
+    }
+
+    /// @brief changes the max number of idle contexts kept, the extra ones are freed now
+    void set_max_pooled(const std::size_t new_max_pooled) {
+        std::lock_guard<std::mutex> lock{mutex};
+        max_pooled = new_max_pooled;
+        while (idle.size() > max_pooled) {
+            stats.bytes -= idle.back()->size_in_bytes();
+            ++stats.discarded;
+            idle.pop_back();
+        }
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        Stats result{stats};
+        result.pooled = idle.size();
+        return result;
+    }
+
+private:
+    NNExecutionContextPool(Factory factory, const std::size_t max_pooled)
+            : factory{std::move(factory)}, max_pooled{max_pooled} {
+    }
+
+    std::unique_ptr<NNExecutionContext> acquire() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!idle.empty()) {
+                auto context{std::move(idle.back())};
+                idle.pop_back();
+                ++stats.reused;
+                ++stats.in_use;
+                return context;
+            }
+        }
+        auto context{factory()};  // outside of the lock, allocates all the buffers
+        std::lock_guard<std::mutex> lock{mutex};
+        ++stats.created;
+        ++stats.in_use;
+        stats.bytes += context->size_in_bytes();
+        return context;
+    }
+
+    void release(std::unique_ptr<NNExecutionContext> context) {
+        std::lock_guard<std::mutex> lock{mutex};
+        --stats.in_use;
+        ++stats.released;
+        if (idle.size() < max_pooled) {
+            idle.push_back(std::move(context));
+        } else {
+            ++stats.discarded;
+            stats.bytes -= context->size_in_bytes();
+        }
+    }
+
+    friend struct detail::ThreadContextLeases;
+
+    const Factory factory;  ///< makes the contexts
+
+    mutable std::mutex mutex;                               ///< protects the members below
+    std::size_t max_pooled;                                 ///< max idle contexts
+    std::vector<std::unique_ptr<NNExecutionContext>> idle;  ///< contexts of ended threads, ready for reuse
+    Stats stats;                                            ///< counters
+};
+
+inline detail::ThreadContextLeases::~ThreadContextLeases() {
+    for (auto& lease : leases) {
+        if (auto pool{lease.owner.lock()}) {
+            pool->release(std::move(lease.context));
+        }
+    }
+}
+
+}  // namespace VPUNN
+
+#endif  // NN_EXECUTION_CONTEXT_POOL_H_
@@ -0,0 +1,194 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_NN_MICRO_BATCHER_H
+#define VPUNN_NN_MICRO_BATCHER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "inference/inference_execution_data.h"
+#include "inference/vpunn_runtime.h"
+
+namespace VPUNN {
+
+/// @brief how the concurrent single inferences are grouped
+struct MicroBatchingConfig {
+    unsigned int max_batch{16};            ///< a batch is run as soon as it has this many descriptors
+    std::chrono::microseconds window{50};  ///< max time the first descriptor of a batch waits for others
+};
+
+/**
+ * @brief Groups the single inferences requested concurrently by different threads into batched inferences.
+ *
+ * A caller of infer() queues its descriptor and blocks until its result is known. There is no worker thread: one of
+ * the waiting callers (the leader) waits at most the window for more descriptors to arrive (or until max_batch are
+ * queued), runs one batched inference for all of them and wakes the others. Only one batch is inferred at a time, the
+ * callers arriving meanwhile are grouped for the next one.
+ *
+ * A batch is inferred on an execution buffer with the smallest power of two batch size (max_batch at most) that fits
+ * it, the unused rows are zero. The result of a descriptor is the same as from a batch 1 inference.
+ * With a single caller every inference waits the whole window, use it only when many threads call concurrently.
+ */
+class NNMicroBatcher {
+public:
+    /// @brief statistics since construction
+    struct Stats {
+        std::size_t requests{0};  ///< inferred descriptors
+        std::size_t batches{0};   ///< batched inferences run
+    };
+
+    /**
+     * @brief Construct a new batcher
+     *
+     * @param runtime the NN, must outlive the batcher
+     * @param descriptor_size number of NN inputs of one descriptor
+     * @param config the batch size and the waiting window
+     */
+    NNMicroBatcher(const Runtime& runtime, const unsigned int descriptor_size, const MicroBatchingConfig& config)
+            : runtime{runtime}, descriptor_size{descriptor_size}, config{config} {
+        if (this->config.max_batch == 0) {
+            this->config.max_batch = 1;
+        }
+        for (unsigned int batch = 1;; batch *= 2) {
+            const auto size{std::min(batch, this->config.max_batch)};
+            buffers.push_back(runtime.createNewInferenceExecutionData(size));
+            if (size == this->config.max_batch) {
+                break;
+            }
+        }
+    }
+
+    NNMicroBatcher(const NNMicroBatcher&) = delete;
+    NNMicroBatcher& operator=(const NNMicroBatcher&) = delete;
+
+    const MicroBatchingConfig& get_config() const noexcept {
+        return config;
+    }
+
+    /**
+     * @brief infers one descriptor, batched with the ones other threads request in the same time
+     *
+     * @param descriptor NN input, descriptor_size elements
+     * @returns the first NN output for the descriptor
+     * @throws the exception of the batched inference, if any (e.g. a descriptor of wrong size)
+     */
+    float infer(const std::vector<float>& descriptor) {
+        Request request{&descriptor};
+        std::unique_lock<std::mutex> lock{mutex};
+        pending.push_back(&request);
+        changed.notify_all();  // the leader waits for the batch to fill
+
+        while (!request.done) {
+            if (leader_active) {
+                changed.wait(lock, [&] {
+                    return request.done || !leader_active;
+                });
+                continue;
+            }
+            leader_active = true;
+            changed.wait_for(lock, config.window, [this] {
+                return pending.size() >= config.max_batch;
+            });
+            const auto count{std::min<std::size_t>(pending.size(), config.max_batch)};
+            std::vector<Request*> batch(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(count));
+            pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(count));
+
+            lock.unlock();
+            run_batch(batch);  // the execution buffers are used only by the leader
+            lock.lock();
+
+            for (auto req : batch) {
+                req->done = true;
+            }
+            stats.requests += batch.size();
+            ++stats.batches;
+            leader_active = false;
+            changed.notify_all();
+        }
+
+        if (request.error) {
+            std::rethrow_exception(request.error);
+        }
+        return request.result;
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        return stats;
+    }
+
+private:
+    struct Request {
+        const std::vector<float>* descriptor;  ///< the input
+        float result{0.0F};                    ///< the output, valid when done without error
+        std::exception_ptr error{};            ///< the exception of the inference, if any
+        bool done{false};                      ///< result or error are set
+    };
+
+    /// infers the batch and sets the results (or the error) of its requests. Does not mark them done
+    void run_batch(const std::vector<Request*>& batch) {
+        std::size_t buffer_idx{0};
+        while (buffer_idx + 1 < buffers.size() && (1U << buffer_idx) < batch.size()) {
+            ++buffer_idx;
+        }
+        auto& buffer{buffers[buffer_idx]};
+        const auto batch_capacity{static_cast<std::size_t>(buffer.input_shapes()[0][0])};
+
+        try {
+            input.assign(batch_capacity * descriptor_size, 0.0F);
+            for (std::size_t idx = 0; idx < batch.size(); idx++) {
+                const auto& descriptor{*batch[idx]->descriptor};
+                if (descriptor.size() != descriptor_size) {
+                    throw std::runtime_error("NNMicroBatcher: descriptor size does not match the NN input");
+                }
+                std::copy(descriptor.cbegin(), descriptor.cend(),
+                          input.begin() + static_cast<std::ptrdiff_t>(idx * descriptor_size));
+            }
+            const float* outputs{
+                    runtime.predict<float>(input.data(), static_cast<unsigned int>(input.size()), buffer)};
+            const auto output_shape{buffer.output_shapes()[0]};  // [batch, outputs...]
+            const auto outputs_per_row{std::accumulate(output_shape.cbegin() + 1, output_shape.cend(), std::size_t{1},
+                                                       std::multiplies<>{})};
+            for (std::size_t idx = 0; idx < batch.size(); idx++) {
+                batch[idx]->result = outputs[idx * outputs_per_row];
+            }
+        } catch (...) {
+            const auto error{std::current_exception()};
+            for (auto req : batch) {
+                req->error = error;
+            }
+        }
+    }
+
+    const Runtime& runtime;                       ///< the NN
+    const unsigned int descriptor_size;           ///< NN inputs of one descriptor
+    MicroBatchingConfig config;                   ///< batching parameters
+    std::vector<InferenceExecutionData> buffers;  ///< batch sizes 1, 2, 4, ..., max_batch
+    std::vector<float> input;                     ///< the descriptors of the running batch
+
+    mutable std::mutex mutex;         ///< protects the members below
+    std::condition_variable changed;  ///< a request arrived, a batch was finished
+    std::deque<Request*> pending;     ///< requests not yet in a batch, oldest first
+    bool leader_active{false};        ///< a caller is forming or running a batch
+    Stats stats;                      ///< counters
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_NN_MICRO_BATCHER_H
@@ -0,0 +1,118 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_INTRA_TILE_SPLIT_MEMO_H
+#define VPUNN_INTRA_TILE_SPLIT_MEMO_H
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <tuple>
+
+#include "vpu/layer.h"
+#include "vpu/layer_split_info.h"
+#include "vpu/optimization/workload_optimization_types.h"
+
+namespace VPUNN {
+
+/**
+ * @brief Remembers the intra-tile split result of tile layers that were already split.
+ *
+ * A tile layer (already sanitized and validated, as resulted from the inter-tile split) together with the options of
+ * the intra-tile split search fully determine the search result, so the result can be reused when the same tile is
+ * seen again, e.g. the layer changed only in the DDR/prefetch context, or only some of its tiles changed.
+ * Eviction is first in first out when the capacity is reached.
+ */
+class IntraTileSplitMemo {
+public:
+    static constexpr std::size_t default_capacity{1024U};  ///< default number of remembered tiles
+
+    explicit IntraTileSplitMemo(const std::size_t max_tiles = default_capacity): capacity{max_tiles} {
+    }
+
+    /// @brief the remembered result of a tile, nullptr if not present
+    const OneTileLayerInfo* find(const DPULayer& tile, const SplitOptions& options) {
+        const auto it{memo.find(Key{tile, options})};
+        if (it == memo.end()) {
+            ++misses;
+            return nullptr;
+        }
+        ++hits;
+        return &it->second;
+    }
+
+    /// @brief remembers the result of a tile. Nothing is stored if capacity is zero
+    void insert(const DPULayer& tile, const SplitOptions& options, const OneTileLayerInfo& result) {
+        if (capacity == 0) {
+            return;
+        }
+        while (memo.size() >= capacity && !insertion_order.empty()) {
+            memo.erase(insertion_order.front());
+            insertion_order.pop_front();
+        }
+        const auto [it, is_new] = memo.emplace(Key{tile, options}, result);
+        if (is_new) {
+            insertion_order.push_back(it);
+        }
+    }
+
+    void clear() {
+        memo.clear();
+        insertion_order.clear();
+        hits = 0;
+        misses = 0;
+    }
+
+    std::size_t size() const noexcept {
+        return memo.size();
+    }
+    std::size_t get_hits() const noexcept {
+        return hits;
+    }
+    std::size_t get_misses() const noexcept {
+        return misses;
+    }
+
+private:
+    /// the tile and the options that influence the intra-tile search
+    struct Key {
+        DPULayer tile;
+        SplitOptions options;
+    };
+
+    /// DPUWorkload::operator< ignores the fields that do not change the cost (offsets, layer_info, cost source hint),
+    /// but they are copied in the resulting workloads so they are part of the key here
+    struct KeyLess {
+        bool operator()(const Key& a, const Key& b) const {
+            if (a.tile < b.tile || b.tile < a.tile) {
+                return a.tile < b.tile;
+            }
+            const auto options_tie = [](const SplitOptions& o) {
+                return std::tie(o.maxWorkloads, o.maxLatencyUs, o.nDPU, o.runtimeOverhead, o.target,
+                                o.availableStrategies, o.pruneSplits, o.detailLevel, o.detailTopK);
+            };
+            return std::forward_as_tuple(a.tile.offsets, a.tile.layer_info, a.tile.cost_source_hint,
+                                         options_tie(a.options)) <
+                   std::forward_as_tuple(b.tile.offsets, b.tile.layer_info, b.tile.cost_source_hint,
+                                         options_tie(b.options));
+        }
+    };
+
+    using Memo = std::map<Key, OneTileLayerInfo, KeyLess>;
+
+    const std::size_t capacity;                  ///< max number of tiles
+    Memo memo;                                   ///< result of each tile
+    std::deque<Memo::iterator> insertion_order;  ///< for eviction, oldest first
+    std::size_t hits{0};                         ///< found tiles
+    std::size_t misses{0};                       ///< not found tiles
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_INTRA_TILE_SPLIT_MEMO_H
@@ -0,0 +1,131 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_SPLIT_POOL_H
+#define VPUNN_SPLIT_POOL_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "vpu/cycles_interface_types.h"
+#include "vpu/layer_split_info.h"
+
+namespace VPUNN {
+
+/**
+ * @brief Flat storage of all the candidate splits of one intra-tile split search.
+ *
+ * The workloads of all splits are kept in one contiguous array and a split is a range of indexes in it, with its
+ * per workload cycles and energy in parallel arrays. All memory comes from a monotonic arena owned by the pool and is
+ * released at once when the pool is destroyed (end of the search), so there is no allocation per split.
+ * Only the splits that are returned to the user are copied out (materialized) as DPUWorkloads.
+ */
+class SplitPool {
+public:
+    static constexpr std::size_t default_arena_bytes{256U * 1024U};  ///< first block of the arena
+
+    /// a split, as a range of workloads in the pool
+    struct Split {
+        std::size_t first{0};                        ///< index of the first workload of the split
+        std::size_t count{0};                        ///< number of workloads
+        CyclesInterfaceType cost{Cycles::NO_ERROR};  ///< cost of the split on the tile (or error code)
+        float energy{0.0f};                          ///< total energy, zero if not computed
+        bool costed{false};                          ///< the cost was computed
+    };
+
+    explicit SplitPool(const std::size_t arena_bytes = default_arena_bytes)
+            : arena{arena_bytes}, workloads{&arena}, cycles{&arena}, energy{&arena}, splits{&arena} {
+    }
+    SplitPool(const SplitPool&) = delete;
+    SplitPool& operator=(const SplitPool&) = delete;
+    ~SplitPool() = default;
+
+    /// @brief moves the workloads of a split at the end of the pool
+    /// @returns the index of the split
+    std::size_t add(DPUWorkloadsWithCyclesSplit&& split) {
+        const std::size_t first{workloads.size()};
+        const std::size_t count{split.workloads.size()};
+        for (auto& wl : split.workloads) {
+            workloads.push_back(std::move(wl));
+        }
+        cycles.resize(first + count, Cycles::NO_ERROR);
+        energy.resize(first + count, 0.0f);
+        splits.push_back({first, count, Cycles::NO_ERROR, 0.0f, false});
+        return splits.size() - 1;
+    }
+
+    /// @brief number of splits
+    std::size_t size() const noexcept {
+        return splits.size();
+    }
+    bool empty() const noexcept {
+        return splits.empty();
+    }
+
+    Split& operator[](const std::size_t idx) noexcept {
+        return splits[idx];
+    }
+    const Split& operator[](const std::size_t idx) const noexcept {
+        return splits[idx];
+    }
+
+    /// @brief first workload of a split, the split has splits[idx].count workloads
+    DPUWorkload* workloads_of(const std::size_t idx) noexcept {
+        return workloads.data() + splits[idx].first;
+    }
+    const DPUWorkload* workloads_of(const std::size_t idx) const noexcept {
+        return workloads.data() + splits[idx].first;
+    }
+
+    /// @brief cycles of the first workload of a split
+    CyclesInterfaceType* cycles_of(const std::size_t idx) noexcept {
+        return cycles.data() + splits[idx].first;
+    }
+
+    /// @brief energy of the first workload of a split
+    float* energy_of(const std::size_t idx) noexcept {
+        return energy.data() + splits[idx].first;
+    }
+
+    /// @brief copy of the workloads of a split
+    DPUWorkloads materialize(const std::size_t idx) const {
+        const auto begin{workloads.cbegin() + static_cast<std::ptrdiff_t>(splits[idx].first)};
+        return DPUWorkloads(begin, begin + static_cast<std::ptrdiff_t>(splits[idx].count));
+    }
+
+    /// @brief copy of a split with its cycles, and energy if it was computed
+    DPUWorkloadsWithCyclesSplit materialize_split(const std::size_t idx, const bool with_energy) const {
+        const auto first{static_cast<std::ptrdiff_t>(splits[idx].first)};
+        const auto last{first + static_cast<std::ptrdiff_t>(splits[idx].count)};
+        DPUWorkloadsWithCyclesSplit split{{cycles.cbegin() + first, cycles.cbegin() + last}, materialize(idx), {}};
+        if (with_energy) {
+            split.energy.assign(energy.cbegin() + first, energy.cbegin() + last);
+        }
+        return split;
+    }
+
+    /// @brief the arena, for temporary data that lives as long as the search
+    std::pmr::memory_resource* resource() noexcept {
+        return &arena;
+    }
+
+private:
+    std::pmr::monotonic_buffer_resource arena;  ///< all the memory of the pool, released at destruction
+
+    std::pmr::vector<DPUWorkload> workloads;       ///< workloads of all splits, contiguous
+    std::pmr::vector<CyclesInterfaceType> cycles;  ///< cycles of each workload
+    std::pmr::vector<float> energy;                ///< energy of each workload
+    std::pmr::vector<Split> splits;                ///< the splits, ranges in the above arrays
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_SPLIT_POOL_H
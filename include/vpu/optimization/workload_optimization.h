@@ -30,14 +30,34 @@ public:
      * workloads split. The information about the device, sparsity are encoded in the DPULayer type. The mode is part of
      * the DPUWorkload structure
      *
+     * When options.pruneSplits is set (LATENCY target) a lower bound is computed for each split from the ideal
+     * (100% MAC utilization) cycles of its workloads, scheduled on the DPUs. Splits are costed in increasing order of
+     * this bound, and the search stops when the bound exceeds the best cost found. The selected split is the same as
+     * for the full search, as long as the cost model never estimates less than the ideal cycles.
+     *
      * @param layer DPULayer to optimize
      * @param options workload splits algorithm configuration options
-     * @param complete_output_splits Output parameter, will be filled with full list of splits investigated
+     * @param complete_output_splits Output parameter, will be filled with the splits investigated (costed) that are
+     * selected by options.detailLevel (default all)
+     * @param stats Output parameter, statistics of the search (candidates, costed, pruned)
      * @return DPUWorkloadsCost the optimal workloads split
      */
-    virtual DPUWorkloadsCost intraTileSplit(
-            const DPULayer& layer, const SplitOptions& options,
-            std::vector<DPUWorkloadsWithCyclesSplit>* complete_output_splits = nullptr) const = 0;
+    virtual DPUWorkloadsCost intraTileSplit(const DPULayer& layer, const SplitOptions& options,
+                                            std::vector<DPUWorkloadsWithCyclesSplit>* complete_output_splits = nullptr,
+                                            SplitSearchStats* stats = nullptr) const = 0;
+
+    /**
+     * @brief Generates the Pareto front of the intra-tile splits of a DPULayer, runtime versus energy
+     * @details All splits that the intraTileSplit would investigate are costed in cycles and energy. The ones that
+     * are not dominated (no other split is at least as good on both axes and better on one) are returned. Splits with
+     * errors are excluded. The target in options is ignored.
+     *
+     * @param layer DPULayer to optimize
+     * @param options workload splits algorithm configuration options
+     * @return the non dominated splits, ordered by increasing cycles (and decreasing energy)
+     */
+    virtual std::vector<DPUWorkloadsPnP> intraTileParetoFront(const DPULayer& layer,
+                                                              const SplitOptions& options) const = 0;
 
     /**
      * @brief Get the cycles and power estimate for a list of workloads.
@@ -47,7 +67,8 @@ public:
      *
      * @param workloads a vector of DPUWorkload
      * @param runtimeOverhead execution runtime overhead in cycles (per workload)
-     * @param skip_power if true power will be zero, otherwise is calculated
+     * @param skip_power if true power and energy will be zero, otherwise are calculated (energy per workload is
+     * stored also in the workloads_split)
      * @return PnPEstimates power and performance estimate for the workloads
      *
      * @throws exceptions from inner dependencies. like DPU invocation
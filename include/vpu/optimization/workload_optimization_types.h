@@ -18,15 +18,22 @@ namespace VPUNN {
 
 /**
  * @brief Available VPU workload generation optimization targets
- *
+ * LATENCY: minimum runtime, POWER: minimum energy, EDP: minimum energy delay product (energy * runtime)
  */
-enum class VPUOptimizationTarget { LATENCY, POWER, EFFICIENCY };
+enum class VPUOptimizationTarget { LATENCY, POWER, EFFICIENCY, EDP };
 /**
  * @brief Available VPU splitting strategies
  *
  */
 enum class VPUSplitStrategy { HW_TILING, Z_TILING, H_TILING, W_TILING };
 
+/**
+ * @brief Which of the investigated intra-tile splits are exported to the caller (complete_output_splits)
+ * NONE: no split, WINNER_ONLY: the selected split, TOP_K: the best detailTopK splits, best first, ALL: every costed
+ * split, in enumeration order
+ */
+enum class SplitDetailLevel { NONE, WINNER_ONLY, TOP_K, ALL };
+
 /**
  * @brief VPU splitting optimization configuration options
  * Used to guide the splitting of a Layer to 1 or more DPUs
@@ -38,12 +45,27 @@ struct SplitOptions {
                            ///< based on the device
     unsigned int runtimeOverhead{0};  ///<  Per workload runtime overhead in cycles
 
-    VPUOptimizationTarget target{VPUOptimizationTarget::LATENCY};  ///< Optimization target. Default is LATENCY,USED
-                                                                   ///< only for LATENCY for the moment
+    VPUOptimizationTarget target{VPUOptimizationTarget::LATENCY};  ///< Optimization target. Default is LATENCY.
+                                                                   ///< EFFICIENCY is treated as LATENCY
     std::vector<VPUSplitStrategy> availableStrategies{
             VPUSplitStrategy::HW_TILING,
             VPUSplitStrategy::Z_TILING};  ///<  Valid strategies for splitting a layer into multiple workloads. Default
                                           ///<  is all (HW tiling and Z tiling)
+
+    bool pruneSplits{false};  ///< LATENCY only: splits are costed in increasing order of their theoretical lower
+                              ///< bound, and the ones whose bound exceeds the best cost found are not costed
+
+    SplitDetailLevel detailLevel{SplitDetailLevel::ALL};  ///< splits exported to the list of investigated splits
+    unsigned int detailTopK{8U};                          ///< number of exported splits for TOP_K
+};
+
+/**
+ * @brief Statistics of the intra-tile split search
+ */
+struct SplitSearchStats {
+    unsigned int candidates{0};  ///< splits generated by the tiling algorithms
+    unsigned int costed{0};      ///< splits costed with the cost model
+    unsigned int pruned{0};      ///< splits not costed because their lower bound exceeded the best cost found
 };
 
 /**
@@ -51,7 +73,8 @@ struct SplitOptions {
  */
 struct PnPEstimates {
     CyclesInterfaceType cycles;  ///< execution cycles
-    float power;                 ///< power in mW
+    float power;                 ///< average power, relative to PowerVirus (energy/cycles)
+    float energy{0.0f};          ///< energy of all the workloads, measured  PowerVirus*cycle
 };
 
 }  // namespace VPUNN
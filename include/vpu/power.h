@@ -10,7 +10,11 @@
 #ifndef VPUNN_POWER_H
 #define VPUNN_POWER_H
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
+#include <iterator>
 #include <list>
 #include <map>
 #include <tuple>
@@ -348,89 +352,107 @@ private:
         return pf_lut_l;
     }
 
-    static inline const pf_lut_t pf_lut{create_pf_lut()};  // the only instance
+    /// @brief one position of a dense per operation curve, valid for log2(input channels) in [k, k+1)
+    /// value at x=log2(input channels) is: value + (x - origin) * slope
+    struct DenseSample {
+        float origin{0.0f};  ///< log2(channels) of the sample the segment starts from
+        float value{0.0f};   ///< power factor at origin
+        float slope{0.0f};   ///< precomputed interpolation slope of the segment, zero outside the sampled range
+    };
+
+    static constexpr std::size_t dense_log2_size{32};  ///< log2 of any unsigned int channel count is below 32
+    static constexpr std::size_t dense_ops_size{static_cast<std::size_t>(Operation::__size)};
+    static constexpr std::size_t dense_devices_size{static_cast<std::size_t>(VPUDevice::__size)};
+
+    /// computation type, index in the dense per device tables
+    enum DenseType : std::size_t { INT8_TYPE = 0, FP16_TYPE, FP8_TYPE, DENSE_TYPES_SIZE };
+
+    using dense_curve_t = std::array<DenseSample, dense_log2_size>;  ///< indexed by floor(log2(input channels))
+
+    /// dense form of a Device_LUT. Operations without samples have an all zero curve (factor 0)
+    struct DenseDevice {
+        float maxvirus{1.0f};
+        std::array<float, DENSE_TYPES_SIZE> adjusters{1.0f, 1.0f, 1.0f};
+        std::array<std::array<dense_curve_t, dense_ops_size>, DENSE_TYPES_SIZE> curves{};
+    };
+
+    using dense_lut_t = std::array<DenseDevice, dense_devices_size>;  ///< indexed by VPUDevice
 
     /**
-     * @brief Logarithmic interpolation between entries of the power factor LUT
+     * @brief Logarithmic interpolation between entries of the power factor LUT, expanded to a dense curve
      * @details the per operation tables are indexed by log2(input channels)
      * Linear interpolation between entries based on log2(input channels) effectively
-     * implements logarithmic interpolation.
+     * implements logarithmic interpolation. What's before the first sample is equal to it, what's after the last
+     * sample is equal to it.
      *
-     * @precondition table must have at least 1 entry and to be ordered low to high
+     * @precondition table must have at least 1 entry
      */
-    static float getValueInterpolation(const unsigned int input_ch, const std::map<unsigned int, float>& table) {
+    static dense_curve_t make_dense_curve(const std::map<unsigned int, float>& table) {
         assert(table.size() >= 1);
-        if (table.size() == 1) {
-            // Single entry table - no interpolation
-            return table.begin()->second;
-        }
-
-        // Get the smaller and greater neighbor
-        // const unsigned int max_ch_log2 = (unsigned int)ceil(log2(8192));  // Max input channels
-        unsigned int smaller = table.cbegin()->first;   // what's before first value is equal to it
-        unsigned int greater = table.crbegin()->first;  // what's after last value is equal to it
-
-        const float input_ch_log2 = std::log2((float)input_ch);
-
-        for (const auto& it : table) {
-            // Find the index below or at input_ch
-            if (((float)it.first <= input_ch_log2) && (it.first > smaller))
-                smaller = it.first;
-
-            // Find the index above or at input_ch
-            if (((float)it.first >= input_ch_log2) && (it.first < greater))
-                greater = it.first;
-
-            if (smaller == greater)
-                break;
+        dense_curve_t curve{};
+        for (unsigned int k = 0; k < dense_log2_size; ++k) {
+            DenseSample& sample{curve[k]};
+            const auto greater = table.upper_bound(k);  // first sample strictly after k
+            if (greater == table.cbegin()) {            // before first sample
+                sample = DenseSample{(float)k, greater->second, 0.0f};
+            } else if (greater == table.cend()) {  // at or after last sample
+                sample = DenseSample{(float)k, table.crbegin()->second, 0.0f};
+            } else {
+                const auto smaller = std::prev(greater);  // sample at or before k
+                const float interval = (float)(greater->first - smaller->first);
+                sample = DenseSample{(float)smaller->first, smaller->second,
+                                     (greater->second - smaller->second) / interval};
+            }
         }
+        return curve;
+    }
 
-        const float interval = (float)(greater - smaller);
-        float interp_value = 0;
-        if (interval > 0) {
-            // Logarithmic interpolation between entries
-            interp_value = table.at(smaller) +
-                           ((input_ch_log2 - (float)smaller) / interval) * (table.at(greater) - table.at(smaller));
-        } else {
-            // Direct hit - no interpolation required
-            interp_value = table.at(smaller);
+    static void fill_dense_curves(const lut_t& lut, std::array<dense_curve_t, dense_ops_size>& curves) {
+        for (const auto& i : lut) {
+            const auto op_idx{static_cast<std::size_t>(std::get<0>(i))};
+            if (op_idx < dense_ops_size && !std::get<1>(i).empty()) {
+                curves[op_idx] = make_dense_curve(std::get<1>(i));
+            }
         }
-        return interp_value;
     }
 
-    static float get_Virus_logical_limit(const VPUDevice device) {
-        for (const auto& i_dev : pf_lut) {
-            if (i_dev.device == device) {
-                return i_dev.maxvirus;  // error fast, no operation found
-            }  // device was found
+    /// builds the dense tables once, from the per device LUTs
+    static dense_lut_t create_dense_lut() {
+        dense_lut_t dense{};
+        for (const auto& i_dev : create_pf_lut()) {
+            DenseDevice& d{dense[static_cast<std::size_t>(i_dev.device)]};
+            d.maxvirus = i_dev.maxvirus;
+            d.adjusters = {i_dev.adjusters.int8_adjustor, i_dev.adjusters.fp16_adjustor,
+                           i_dev.adjusters.fpx8_adjustor};
+            fill_dense_curves(i_dev.int8_lut, d.curves[INT8_TYPE]);
+            fill_dense_curves(i_dev.fp16_lut, d.curves[FP16_TYPE]);
+            fill_dense_curves(i_dev.fp8_lut, d.curves[FP8_TYPE]);
         }
-        return 1.0f;  // nothing found , use default
+        return dense;
     }
 
-    inline static const lut_t& get_power_lut_based_on_type(const DPUWorkload& wl, const device_lut_t& device_lut,
-                                                           const HWPerformanceModel& performanceInfo) {
-        if (performanceInfo.native_comp_on_fp16(wl)) {
-            return device_lut.fp16_lut;  // FP16;
-        } else if (performanceInfo.native_comp_on_fp8(wl)) {
-            return device_lut.fp8_lut;  // FP8
-        } else if (performanceInfo.native_comp_on_i8(wl)) {
-            return device_lut.int8_lut;  // INT8
-        }
+    static inline const dense_lut_t dense_lut{create_dense_lut()};  // the only instance
 
-        return device_lut.int8_lut;  // default to INT8;
+    /// O(1) value of a dense curve for a number of input channels
+    static float getValueInterpolation(const unsigned int input_ch, const dense_curve_t& curve) {
+        const float input_ch_log2{input_ch > 1 ? std::log2((float)input_ch) : 0.0f};
+        const auto k{std::min(static_cast<std::size_t>(input_ch_log2), dense_log2_size - 1)};
+        const DenseSample& sample{curve[k]};
+        return sample.value + (input_ch_log2 - sample.origin) * sample.slope;
     }
 
-    inline static float get_adjustment_factor_based_on_type(const DPUWorkload& wl, const device_lut_t& device_lut,
-                                                            const HWPerformanceModel& performanceInfo) {
+    static float get_Virus_logical_limit(const VPUDevice device) {
+        const auto dev_idx{static_cast<std::size_t>(device)};
+        return (dev_idx < dense_devices_size) ? dense_lut[dev_idx].maxvirus : 1.0f;  // default if nothing found
+    }
+
+    inline static DenseType get_dense_type(const DPUWorkload& wl, const HWPerformanceModel& performanceInfo) {
         if (performanceInfo.native_comp_on_fp16(wl)) {
-            return device_lut.adjusters.fp16_adjustor;  // FP16;
+            return FP16_TYPE;
         } else if (performanceInfo.native_comp_on_fp8(wl)) {
-            return device_lut.adjusters.fpx8_adjustor;  // FP8
-        } else if (performanceInfo.native_comp_on_i8(wl)) {
-            return device_lut.adjusters.int8_adjustor;  // INT8
+            return FP8_TYPE;
         }
-
-        return device_lut.adjusters.int8_adjustor;  // default to INT8;
+        return INT8_TYPE;  // INT8 and default
     }
 
 public:
@@ -438,35 +460,24 @@ public:
      * @brief Get the value from the LUT+ extra info for a specific workload, represents the relative power factor
      * adjustment towards the PowerVirus (INT8). The factor will take in consideration all aspects of the WL ,
      * operation, type, etc
+     * Constant time: the device, type and operation index dense tables, no search is done.
      *
      * @param wl the workload for which to compute the factor.
-     * @return  the adjustment factor
+     * @return  the adjustment factor, zero if device or operation are not known
      */
     static float getOperationAndPowerVirusAdjustementFactor(const DPUWorkload& wl,
                                                             const HWPerformanceModel& performanceInfo) {
-        //  Get values table for the device
-        for (const auto& i_dev : pf_lut) {
-            if (i_dev.device == wl.device) {
-                const lut_t& operations_table{get_power_lut_based_on_type(wl, i_dev, performanceInfo)};
-
-                // Get the power factor value
-                for (const auto& i : operations_table) {
-                    const Operation operation = std::get<0>(i);
-
-                    if (operation == wl.op) {
-                        const std::map<unsigned int, float>& op_values_map = std::get<1>(i);
-                        const auto pf_interpolated{
-                                getValueInterpolation(wl.inputs[0].channels(), op_values_map)};  // type knowing factor
-                        const float pf_adjusted{
-                                pf_interpolated *
-                                get_adjustment_factor_based_on_type(wl, i_dev, performanceInfo)};  // type adjuster
-                        return pf_adjusted;                                                        // early exit OK
-                    }
-                }
-                return 0.0f;  // error fast, no operation found
-            }  // device was found
+        const auto dev_idx{static_cast<std::size_t>(wl.device)};
+        const auto op_idx{static_cast<std::size_t>(wl.op)};
+        if (dev_idx >= dense_devices_size || op_idx >= dense_ops_size) {
+            return 0.0f;  // error , nothing found
         }
-        return 0.0f;  // error , nothing found
+
+        const DenseDevice& i_dev{dense_lut[dev_idx]};
+        const DenseType type{get_dense_type(wl, performanceInfo)};
+        const float pf_interpolated{
+                getValueInterpolation(wl.inputs[0].channels(), i_dev.curves[type][op_idx])};  // type knowing factor
+        return pf_interpolated * i_dev.adjusters[type];  // type adjuster, unknown op has a zero curve
     }
 
     // redesign this
@@ -86,6 +86,11 @@ public:
 
     ~L2CostSerializationWrap() = default;
 
+    /// true if serializeLayerSplitInfo will write the splits, then every investigated intra-tile split is needed
+    bool needs_all_intra_tile_splits() const {
+        return is_serialization_enabled() && !is_error_present_during_serialization();
+    }
+
     /// prevents to multiple wrappers to share the same references
     L2CostSerializationWrap(const L2CostSerializationWrap&) = delete;
     L2CostSerializationWrap& operator=(const L2CostSerializationWrap&) = delete;
@@ -0,0 +1,173 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_SERIALIZATION_MEMBER_FIELDS_H
+#define VPUNN_SERIALIZATION_MEMBER_FIELDS_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vpu/dpu_types.h"
+#include "vpu/serializer_utils.h"
+
+namespace VPUNN {
+
+/// @brief Compile time descriptor of one serializable member of a record type (DPUOperation, SHAVEOperation, ...).
+///
+/// A record type exposes a static table of these (see `_get_member_fields()`). Each descriptor binds a field name
+/// (the CSV column) to functions instantiated for the concrete member type, so serializing or hashing a record is a
+/// plain loop over the table, without building any per instance map of references.
+template <class Owner>
+struct MemberField {
+    const char* name;  ///< field name, e.g. column name in a CSV file
+
+    std::string (*to_text)(const Owner&);                ///< value of the field as serialized text
+    bool (*from_text)(Owner&, const std::string& text);  ///< sets the field from text, false if conversion failed
+    void (*on_absent)(Owner&);  ///< called when the field is not present in the source. nullptr: keep current value
+    std::size_t (*hash)(const Owner&);  ///< hash of the field value
+};
+
+/// the compile time table of fields for a record type
+template <class Owner, std::size_t N>
+using MemberFieldTable = std::array<MemberField<Owner>, N>;
+
+namespace member_fields {
+
+/// end of a member path
+template <class Obj>
+constexpr Obj& follow(Obj& obj) noexcept {
+    return obj;
+}
+
+/// follows a member path: pointers to members are dereferenced, integral steps are used as an index
+template <class Obj, class Step, class... Rest>
+constexpr decltype(auto) follow(Obj& obj, Step step, Rest... rest) noexcept {
+    if constexpr (std::is_integral_v<Step>) {
+        return follow(obj[step], rest...);
+    } else {
+        return follow(obj.*step, rest...);
+    }
+}
+
+/// textual representation of a value, enums are written as <EnumName>.<EnumStringValue>
+template <class T>
+std::string value_to_text(const T& value) {
+    if constexpr (has_mapToText<T>::value && has_enumName<T>::value) {
+        return enumName<T>() + "." + mapToText<T>().at(static_cast<int>(value));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return value;
+    } else {
+        return std::to_string(value);
+    }
+}
+
+/// parses a value from its textual representation
+template <class T>
+bool value_from_text(T& value, const std::string& text) {
+    std::istringstream ss(text);
+    ss >> value;
+    return !ss.fail();
+}
+
+/// same combination as boost::hash_combine
+inline std::size_t hash_combine(std::size_t seed, std::size_t value) noexcept {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/// codec for a field that is a plain (nested) data member reached via a member path
+template <class Owner, auto... Path>
+struct PathField {
+    using value_type = std::decay_t<decltype(follow(std::declval<Owner&>(), Path...))>;
+
+    static std::string to_text(const Owner& o) {
+        return value_to_text<value_type>(follow(o, Path...));
+    }
+    static bool from_text(Owner& o, const std::string& text) {
+        return value_from_text<value_type>(follow(o, Path...), text);
+    }
+    static std::size_t hash(const Owner& o) {
+        return std::hash<value_type>{}(follow(o, Path...));
+    }
+};
+
+/// codec for a field that is computed by a getter and set by a setter (see SetGet_MemberMapValues semantics)
+template <class Owner, DimType (*Get)(const Owner&), void (*Set)(Owner&, const std::string&)>
+struct AccessorField {
+    static std::string to_text(const Owner& o) {
+        return std::to_string(Get(o));
+    }
+    static bool from_text(Owner& o, const std::string& text) {
+        Set(o, text);
+        return true;
+    }
+    static void on_absent(Owner& o) {
+        Set(o, "");  // the setter decides the value: default or computed from the other fields
+    }
+    static std::size_t hash(const Owner& o) {
+        return std::hash<int>{}(Get(o));
+    }
+};
+
+}  // namespace member_fields
+
+/// @brief descriptor for a data member reached via a member path, e.g. `field<Op, &Op::input_0, &TensorInfo::batch>`.
+/// Integral path steps index into arrays: `field<Op, &Op::input_tensors, 3, &TensorInfo::batch>`
+template <class Owner, auto... Path>
+constexpr MemberField<Owner> field(const char* name) noexcept {
+    using Codec = member_fields::PathField<Owner, Path...>;
+    return MemberField<Owner>{name, &Codec::to_text, &Codec::from_text, nullptr, &Codec::hash};
+}
+
+/// @brief descriptor for a field that is exposed via getter/setter functions instead of a data member
+template <class Owner, DimType (*Get)(const Owner&), void (*Set)(Owner&, const std::string&)>
+constexpr MemberField<Owner> accessor_field(const char* name) noexcept {
+    using Codec = member_fields::AccessorField<Owner, Get, Set>;
+    return MemberField<Owner>{name, &Codec::to_text, &Codec::from_text, &Codec::on_absent, &Codec::hash};
+}
+
+/// @brief list of the names in a field table, in table order
+template <class Owner, std::size_t N>
+std::vector<std::string> member_field_names(const MemberFieldTable<Owner, N>& table) {
+    std::vector<std::string> names;
+    names.reserve(N);
+    for (const auto& f : table) {
+        names.emplace_back(f.name);
+    }
+    return names;
+}
+
+/// @brief combined hash of all the fields in a table, in table order
+template <class Owner, std::size_t N>
+std::size_t member_fields_hash(const MemberFieldTable<Owner, N>& table, const Owner& obj) {
+    std::size_t combined_hash = 0;
+    for (const auto& f : table) {
+        combined_hash = member_fields::hash_combine(combined_hash, f.hash(obj));
+    }
+    return combined_hash;
+}
+
+/// Trait to check if a type T exposes a compile time field table via T::_get_member_fields()
+template <typename T, typename = void>
+struct has_member_fields : std::false_type {};
+
+template <typename T>
+struct has_member_fields<T, std::void_t<decltype(T::_get_member_fields())>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool has_member_fields_v = has_member_fields<T>::value;
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_SERIALIZATION_MEMBER_FIELDS_H
@@ -52,19 +52,18 @@ inline T dpu_schedule(const unsigned int n_procesors, const std::vector<T>& task
     return result;
 }
 
-template <>
-inline CyclesInterfaceType dpu_schedule(const unsigned int n_procesors,
-                                        const std::vector<CyclesInterfaceType>& tasks_cost,
-                                        const CyclesInterfaceType runtime_overhead) {
+/// @brief same as dpu_schedule for a vector of cycles, the tasks are given as a range [first, last)
+inline CyclesInterfaceType dpu_schedule(const unsigned int n_procesors, const CyclesInterfaceType* first,
+                                        const CyclesInterfaceType* last, const CyclesInterfaceType runtime_overhead) {
     const auto initializer = std::vector<CyclesInterfaceType>(n_procesors, 0);
     // MIN priority queue, one element per processor, minimum used processor first.
     auto queue = std::priority_queue<CyclesInterfaceType, std::vector<CyclesInterfaceType>,
                                      std::greater<CyclesInterfaceType>>(initializer.begin(), initializer.end());
 
-    for (const auto& cost : tasks_cost) {
+    for (auto it = first; it != last; ++it) {
         const CyclesInterfaceType smallest_time = queue.top();
         queue.pop();
-        queue.push(Cycles::cost_adder(Cycles::cost_adder(smallest_time, cost), runtime_overhead));
+        queue.push(Cycles::cost_adder(Cycles::cost_adder(smallest_time, *it), runtime_overhead));
     }
 
     // Return the max of the queue -> the execution critical path (last in queue)
@@ -76,6 +75,13 @@ inline CyclesInterfaceType dpu_schedule(const unsigned int n_procesors,
     return result;
 }
 
+template <>
+inline CyclesInterfaceType dpu_schedule(const unsigned int n_procesors,
+                                        const std::vector<CyclesInterfaceType>& tasks_cost,
+                                        const CyclesInterfaceType runtime_overhead) {
+    return dpu_schedule(n_procesors, tasks_cost.data(), tasks_cost.data() + tasks_cost.size(), runtime_overhead);
+}
+
 /**
  * @brief Multiply and accumulate an array
  *
@@ -16,6 +16,7 @@
 #include "vpu/types.h"
 
 #include <sstream>
+#include <tuple>
 
 namespace VPUNN {
 
@@ -183,6 +184,12 @@ public:
             throw std::runtime_error(details);
         }
     }
+
+    /// @brief gets the valid values of a device by their type, resolved at compile time. Only for one of DeviceValues
+    template <class Values>
+    const Values& get_config_of() const noexcept {
+        return std::get<Values>(specific_vv);
+    }
 };
 
 }  // namespace VPUNN
@@ -12,11 +12,8 @@
 
 #include <functional>
 #include <iostream>
-#include <mutex>
 #include <sstream>
 #include <string>
-#include <unordered_map>
-#include <variant>
 #include <vector>
 
 #include "core/serializer.h"
@@ -24,6 +21,7 @@
 #include "vpu/dpu_types.h"
 #include "vpu/dpu_workload.h"
 #include "vpu/profiling_service.h"
+#include "vpu/serialization/member_fields.h"
 #include "vpu/serializer_utils.h"
 
 namespace VPUNN {
@@ -215,15 +213,6 @@ struct DPUOperation {
     /// this flag indicates if current operation does also the reduce min/max along with the main operation
     bool reduce_minmax_op{false};
 
-    using _ref_supported_type =
-            std::variant<std::reference_wrapper<VPUDevice>, std::reference_wrapper<Operation>,
-                         std::reference_wrapper<DataType>, std::reference_wrapper<Layout>,
-                         std::reference_wrapper<Swizzling>, std::reference_wrapper<ActivationFunction>,
-                         std::reference_wrapper<ExecutionMode>, std::reference_wrapper<ISIStrategy>,
-                         std::reference_wrapper<DimType>, std::reference_wrapper<long long>,
-                         std::reference_wrapper<MPEEngine>, std::reference_wrapper<int>, std::reference_wrapper<float>,
-                         std::reference_wrapper<bool>, VPUNN::SetGet_MemberMapValues>;
-
     void set_intended_split(ISIStrategy strategy, unsigned int nTiles) {
         isi_strategy = strategy;
         output_write_tiles = static_cast<int>(nTiles);
@@ -285,7 +274,7 @@ struct DPUOperation {
               halo{r.halo},
               input_0_memory_dense{r.input_0_memory_dense},
               output_0_memory_dense{r.output_0_memory_dense},
-              sep_activators{r.sep_activators}, /*_member_map{}*/
+              sep_activators{r.sep_activators},
               weightless_operation{r.weightless_operation},
               in_place_output_memory{r.in_place_output_memory},
               superdense{r.superdense},
@@ -448,319 +437,166 @@ struct DPUOperation {
 
     friend std::ostream& operator<<(std::ostream& stream, const DPUOperation& d);
 
-    using MemberMapType = std::unordered_map<std::string, _ref_supported_type>;
+    /// @brief compile time table of the serializable fields, in serialization order.
+    /// Order matters at deserialization: computed fields (in_place_input1, in_place_output) are set after the
+    /// tensors they are derived from.
+    static const auto& _get_member_fields() {
+        using Op = DPUOperation;
+        using T = TensorInfo;
+        using K = KernelInfo;
+        using H = HaloWorkload;
+        using Shape = WHCBTensorShape;
+        using SEP = SEPModeInfo;
+        static constexpr std::array fields{  // size deduced from the entries
+                field<Op, &Op::device>("device"),
+                field<Op, &Op::operation>("operation"),
+                field<Op, &Op::input_0, &T::batch>("input_0_batch"),
+                field<Op, &Op::input_0, &T::channels>("input_0_channels"),
+                field<Op, &Op::input_0, &T::height>("input_0_height"),
+                field<Op, &Op::input_0, &T::width>("input_0_width"),
+                field<Op, &Op::input_1, &T::batch>("input_1_batch"),
+                field<Op, &Op::input_1, &T::channels>("input_1_channels"),
+                field<Op, &Op::input_1, &T::height>("input_1_height"),
+                field<Op, &Op::input_1, &T::width>("input_1_width"),
+                field<Op, &Op::input_0, &T::sparsity_enabled>("input_sparsity_enabled"),
+                field<Op, &Op::input_1, &T::sparsity_enabled>("weight_sparsity_enabled"),
+                field<Op, &Op::input_0, &T::sparsity>("input_sparsity_rate"),
+                field<Op, &Op::input_1, &T::sparsity>("weight_sparsity_rate"),
+                field<Op, &Op::execution_order>("execution_order"),
+                field<Op, &Op::activation_function>("activation_function"),
+                field<Op, &Op::kernel, &K::height>("kernel_height"),
+                field<Op, &Op::kernel, &K::width>("kernel_width"),
+                field<Op, &Op::kernel, &K::pad_bottom>("kernel_pad_bottom"),
+                field<Op, &Op::kernel, &K::pad_left>("kernel_pad_left"),
+                field<Op, &Op::kernel, &K::pad_right>("kernel_pad_right"),
+                field<Op, &Op::kernel, &K::pad_top>("kernel_pad_top"),
+                field<Op, &Op::kernel, &K::stride_height>("kernel_stride_height"),
+                field<Op, &Op::kernel, &K::stride_width>("kernel_stride_width"),
+                field<Op, &Op::output_0, &T::batch>("output_0_batch"),
+                field<Op, &Op::output_0, &T::channels>("output_0_channels"),
+                field<Op, &Op::output_0, &T::height>("output_0_height"),
+                field<Op, &Op::output_0, &T::width>("output_0_width"),
+                field<Op, &Op::input_0, &T::datatype>("input_0_datatype"),
+                field<Op, &Op::input_0, &T::layout>("input_0_layout"),
+                field<Op, &Op::input_0, &T::swizzling>("input_0_swizzling"),
+                field<Op, &Op::input_1, &T::datatype>("input_1_datatype"),
+                field<Op, &Op::input_1, &T::layout>("input_1_layout"),
+                field<Op, &Op::input_1, &T::swizzling>("input_1_swizzling"),
+                field<Op, &Op::output_0, &T::datatype>("output_0_datatype"),
+                field<Op, &Op::output_0, &T::layout>("output_0_layout"),
+                field<Op, &Op::output_0, &T::swizzling>("output_0_swizzling"),
+                field<Op, &Op::output_0, &T::sparsity_enabled>("output_sparsity_enabled"),
+                field<Op, &Op::isi_strategy>("isi_strategy"),
+                field<Op, &Op::output_write_tiles>("output_write_tiles"),
+
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::top>("input_0_halo_top"),
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::bottom>("input_0_halo_bottom"),
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::left>("input_0_halo_left"),
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::right>("input_0_halo_right"),
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::front>("input_0_halo_front"),
+                field<Op, &Op::halo, &H::input_0_halo, &H::HaloInfoHWC::back>("input_0_halo_back"),
+
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::top>("output_0_halo_top"),
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::bottom>("output_0_halo_bottom"),
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::left>("output_0_halo_left"),
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::right>("output_0_halo_right"),
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::front>("output_0_halo_front"),
+                field<Op, &Op::halo, &H::output_0_halo, &H::HaloInfoHWC::back>("output_0_halo_back"),
+
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::top>(
+                        "output_0_halo_broadcast_top"),
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::bottom>(
+                        "output_0_halo_broadcast_bottom"),
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::left>(
+                        "output_0_halo_broadcast_left"),
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::right>(
+                        "output_0_halo_broadcast_right"),
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::front>(
+                        "output_0_halo_broadcast_front"),
+                field<Op, &Op::halo, &H::output_0_halo_broadcast_cnt, &H::HaloInfoHWC::back>(
+                        "output_0_halo_broadcast_back"),
+
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::top>("output_0_halo_inbound_top"),
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::bottom>(
+                        "output_0_halo_inbound_bottom"),
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::left>("output_0_halo_inbound_left"),
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::right>(
+                        "output_0_halo_inbound_right"),
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::front>(
+                        "output_0_halo_inbound_front"),
+                field<Op, &Op::halo, &H::output_0_inbound_halo, &H::HaloInfoHWC::back>("output_0_halo_inbound_back"),
+
+                field<Op, &Op::sep_activators, &SEP::sep_activators>("sep_enabled"),
+                accessor_field<Op, &get_sep_dim<&SEP::storage_elements_pointers, &Shape::width>,
+                               &set_sep_dim<&SEP::storage_elements_pointers, &Shape::set_width>>("sep_w"),
+                accessor_field<Op, &get_sep_dim<&SEP::storage_elements_pointers, &Shape::height>,
+                               &set_sep_dim<&SEP::storage_elements_pointers, &Shape::set_height>>("sep_h"),
+                accessor_field<Op, &get_sep_dim<&SEP::storage_elements_pointers, &Shape::channels>,
+                               &set_sep_dim<&SEP::storage_elements_pointers, &Shape::set_channels>>("sep_c"),
+                accessor_field<Op, &get_sep_dim<&SEP::storage_elements_pointers, &Shape::batches>,
+                               &set_sep_dim<&SEP::storage_elements_pointers, &Shape::set_batches>>("sep_b"),
+                accessor_field<Op, &get_sep_dim<&SEP::actual_activators_input, &Shape::width>,
+                               &set_sep_dim<&SEP::actual_activators_input, &Shape::set_width>>("sep_act_w"),
+                accessor_field<Op, &get_sep_dim<&SEP::actual_activators_input, &Shape::height>,
+                               &set_sep_dim<&SEP::actual_activators_input, &Shape::set_height>>("sep_act_h"),
+                accessor_field<Op, &get_sep_dim<&SEP::actual_activators_input, &Shape::channels>,
+                               &set_sep_dim<&SEP::actual_activators_input, &Shape::set_channels>>("sep_act_c"),
+                accessor_field<Op, &get_sep_dim<&SEP::actual_activators_input, &Shape::batches>,
+                               &set_sep_dim<&SEP::actual_activators_input, &Shape::set_batches>>("sep_act_b"),
+                field<Op, &Op::sep_activators, &SEP::no_sparse_map>("sep_no_sparse_map"),
+                // not the same name as the attribute weightless_operation
+                accessor_field<Op, &get_weightless_operation, &set_weightless_operation>("in_place_input1"),
+                // not the same name as the attribute in_place_output_memory
+                accessor_field<Op, &get_in_place_output_memory, &set_in_place_output_memory>("in_place_output"),
+                // not the same name as the attribute superdense
+                field<Op, &Op::superdense>("superdense_output"),
+                field<Op, &Op::input_autopad>("input_autopad"),
+                field<Op, &Op::output_autopad>("output_autopad"),
+                field<Op, &Op::mpe_engine>("mpe_engine"),
+                field<Op, &Op::reduce_minmax_op>("reduce_minmax_op"),
+        };
+        return fields;
+    }
 
-    const MemberMapType& get_member_map() const {
-        ensure_member_map();
-        return _member_map;
+    static const std::vector<std::string>& _get_member_names() {
+        static const std::vector<std::string> names{member_field_names(_get_member_fields())};
+        return names;
     }
-    MemberMapType& get_member_map() {
-        ensure_member_map();
-        return _member_map;
+
+    size_t hash() const {
+        return member_fields_hash(_get_member_fields(), *this);
     }
 
 private:
-    mutable MemberMapType _member_map{};
-    /// non const member map population
-    void populate_member_map() {
-        _member_map = MemberMapType{
-                {"device", std::ref(device)},
-                {"operation", std::ref(operation)},
-                {"input_0_batch", std::ref(input_0.batch)},
-                {"input_0_channels", std::ref(input_0.channels)},
-                {"input_0_height", std::ref(input_0.height)},
-                {"input_0_width", std::ref(input_0.width)},
-                {"input_1_batch", std::ref(input_1.batch)},
-                {"input_1_channels", std::ref(input_1.channels)},
-                {"input_1_height", std::ref(input_1.height)},
-                {"input_1_width", std::ref(input_1.width)},
-                {"input_sparsity_enabled", std::ref(input_0.sparsity_enabled)},
-                {"weight_sparsity_enabled", std::ref(input_1.sparsity_enabled)},
-                {"input_sparsity_rate", std::ref(input_0.sparsity)},
-                {"weight_sparsity_rate", std::ref(input_1.sparsity)},
-                {"execution_order", std::ref(execution_order)},
-                {"activation_function", std::ref(activation_function)},
-                {"kernel_height", std::ref(kernel.height)},
-                {"kernel_width", std::ref(kernel.width)},
-                {"kernel_pad_bottom", std::ref(kernel.pad_bottom)},
-                {"kernel_pad_left", std::ref(kernel.pad_left)},
-                {"kernel_pad_right", std::ref(kernel.pad_right)},
-                {"kernel_pad_top", std::ref(kernel.pad_top)},
-                {"kernel_stride_height", std::ref(kernel.stride_height)},
-                {"kernel_stride_width", std::ref(kernel.stride_width)},
-                {"output_0_batch", std::ref(output_0.batch)},
-                {"output_0_channels", std::ref(output_0.channels)},
-                {"output_0_height", std::ref(output_0.height)},
-                {"output_0_width", std::ref(output_0.width)},
-                {"input_0_datatype", std::ref(input_0.datatype)},
-                {"input_0_layout", std::ref(input_0.layout)},
-                {"input_0_swizzling", std::ref(input_0.swizzling)},
-                {"input_1_datatype", std::ref(input_1.datatype)},
-                {"input_1_layout", std::ref(input_1.layout)},
-                {"input_1_swizzling", std::ref(input_1.swizzling)},
-                {"output_0_datatype", std::ref(output_0.datatype)},
-                {"output_0_layout", std::ref(output_0.layout)},
-                {"output_0_swizzling", std::ref(output_0.swizzling)},
-                {"output_sparsity_enabled", std::ref(output_0.sparsity_enabled)},
-                {"isi_strategy", std::ref(isi_strategy)},
-                {"output_write_tiles", std::ref(output_write_tiles)},
-
-                {"input_0_halo_top", std::ref(halo.input_0_halo.top)},
-                {"input_0_halo_bottom", std::ref(halo.input_0_halo.bottom)},
-                {"input_0_halo_left", std::ref(halo.input_0_halo.left)},
-                {"input_0_halo_right", std::ref(halo.input_0_halo.right)},
-                {"input_0_halo_front", std::ref(halo.input_0_halo.front)},
-                {"input_0_halo_back", std::ref(halo.input_0_halo.back)},
-
-                {"output_0_halo_top", std::ref(halo.output_0_halo.top)},
-                {"output_0_halo_bottom", std::ref(halo.output_0_halo.bottom)},
-                {"output_0_halo_left", std::ref(halo.output_0_halo.left)},
-                {"output_0_halo_right", std::ref(halo.output_0_halo.right)},
-                {"output_0_halo_front", std::ref(halo.output_0_halo.front)},
-                {"output_0_halo_back", std::ref(halo.output_0_halo.back)},
-
-                {"output_0_halo_broadcast_top", std::ref(halo.output_0_halo_broadcast_cnt.top)},
-                {"output_0_halo_broadcast_bottom", std::ref(halo.output_0_halo_broadcast_cnt.bottom)},
-                {"output_0_halo_broadcast_left", std::ref(halo.output_0_halo_broadcast_cnt.left)},
-                {"output_0_halo_broadcast_right", std::ref(halo.output_0_halo_broadcast_cnt.right)},
-                {"output_0_halo_broadcast_front", std::ref(halo.output_0_halo_broadcast_cnt.front)},
-                {"output_0_halo_broadcast_back", std::ref(halo.output_0_halo_broadcast_cnt.back)},
-
-                {"output_0_halo_inbound_top", std::ref(halo.output_0_inbound_halo.top)},
-                {"output_0_halo_inbound_bottom", std::ref(halo.output_0_inbound_halo.bottom)},
-                {"output_0_halo_inbound_left", std::ref(halo.output_0_inbound_halo.left)},
-                {"output_0_halo_inbound_right", std::ref(halo.output_0_inbound_halo.right)},
-                {"output_0_halo_inbound_front", std::ref(halo.output_0_inbound_halo.front)},
-                {"output_0_halo_inbound_back", std::ref(halo.output_0_inbound_halo.back)},
-
-                {"sep_enabled", std::ref(sep_activators.sep_activators)},
-                {"sep_w",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.storage_elements_pointers.set_width(value);
-                         }
-                     }
-                     return sep_activators.storage_elements_pointers.width();
-                 }},
-                {"sep_h",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.storage_elements_pointers.set_height(value);
-                         }
-                     }
-                     return sep_activators.storage_elements_pointers.height();
-                 }},
-                {"sep_c",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.storage_elements_pointers.set_channels(value);
-                         }
-                     }
-                     return sep_activators.storage_elements_pointers.channels();
-                 }},
-                {"sep_b",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.storage_elements_pointers.set_batches(value);
-                         }
-                     }
-                     return sep_activators.storage_elements_pointers.batches();
-                 }},
-                {"sep_act_w",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.actual_activators_input.set_width(value);
-                         }
-                     }
-                     return sep_activators.actual_activators_input.width();
-                 }},
-                {"sep_act_h",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.actual_activators_input.set_height(value);
-                         }
-                     }
-                     return sep_activators.actual_activators_input.height();
-                 }},
-                {"sep_act_c",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.actual_activators_input.set_channels(value);
-                         }
-                     }
-                     return sep_activators.actual_activators_input.channels();
-                 }},
-                {"sep_act_b",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         DimType value;
-                         if (is_unsigned_int(s, value)) {
-                             sep_activators.actual_activators_input.set_batches(value);
-                         }
-                     }
-                     return sep_activators.actual_activators_input.batches();
-                 }},
-                {"sep_no_sparse_map", std::ref(sep_activators.no_sparse_map)},
-                {"in_place_input1",  // weightless_operation
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         setWeightlessOperation(s);
-                     }
-                     return weightless_operation;
-                 }},
-                {"in_place_output",
-                 [this](bool set_mode, std::string s) -> DimType {
-                     if (set_mode) {
-                         setInPlaceOutputMemory(s);
-                     }
-                     return in_place_output_memory;
-                 }},
-                {"superdense_output", std::ref(superdense)},
-                {"input_autopad", std::ref(input_autopad)},
-                {"output_autopad", std::ref(output_autopad)},
-                {"mpe_engine", std::ref(mpe_engine)},
-                {"reduce_minmax_op", std::ref(reduce_minmax_op)},
-        };
+    /// getter for a SEP shape dimension, used as a serializable field
+    template <WHCBTensorShape SEPModeInfo::*Shape, DimType (WHCBTensorShape::*Get)() const noexcept>
+    static DimType get_sep_dim(const DPUOperation& op) {
+        return ((op.sep_activators.*Shape).*Get)();
     }
-
-    mutable std::mutex _member_map_mutex{};
-    void ensure_member_map() const {
-        std::lock_guard<std::mutex> lock(_member_map_mutex);
-        if (is_member_map_initialized()) {
-            return;
+    /// setter for a SEP shape dimension, used as a serializable field. Invalid text leaves the value unchanged
+    template <WHCBTensorShape SEPModeInfo::*Shape, void (WHCBTensorShape::*Set)(DimType)>
+    static void set_sep_dim(DPUOperation& op, const std::string& s) {
+        DimType value;
+        if (is_unsigned_int(s, value)) {
+            ((op.sep_activators.*Shape).*Set)(value);
         }
-        (const_cast<DPUOperation*>(this))->populate_member_map();
     }
-    bool is_member_map_initialized() const {
-        return !_member_map.empty();  // NOT empty
-    }
-
-public:
-    static const std::vector<std::string>& _get_member_names() {
-        static const std::vector<std::string> names{
-                "device",
-                "operation",
-                "input_0_batch",
-                "input_0_channels",
-                "input_0_height",
-                "input_0_width",
-                "input_1_batch",
-                "input_1_channels",
-                "input_1_height",
-                "input_1_width",
-                "input_sparsity_enabled",
-                "weight_sparsity_enabled",
-                "input_sparsity_rate",
-                "weight_sparsity_rate",
-                "execution_order",
-                "activation_function",
-                "kernel_height",
-                "kernel_width",
-                "kernel_pad_bottom",
-                "kernel_pad_left",
-                "kernel_pad_right",
-                "kernel_pad_top",
-                "kernel_stride_height",
-                "kernel_stride_width",
-                "output_0_batch",
-                "output_0_channels",
-                "output_0_height",
-                "output_0_width",
-                "input_0_datatype",
-                "input_0_layout",
-                "input_0_swizzling",
-                "input_1_datatype",
-                "input_1_layout",
-                "input_1_swizzling",
-                "output_0_datatype",
-                "output_0_layout",
-                "output_0_swizzling",
-                "output_sparsity_enabled",
-                "isi_strategy",
-                "output_write_tiles",
-                "input_0_halo_top",
-                "input_0_halo_bottom",
-                "input_0_halo_left",
-                "input_0_halo_right",
-                "input_0_halo_front",
-                "input_0_halo_back",
-                "output_0_halo_top",
-                "output_0_halo_bottom",
-                "output_0_halo_left",
-                "output_0_halo_right",
-                "output_0_halo_front",
-                "output_0_halo_back",
-                "output_0_halo_broadcast_top",
-                "output_0_halo_broadcast_bottom",
-                "output_0_halo_broadcast_left",
-                "output_0_halo_broadcast_right",
-                "output_0_halo_broadcast_front",
-                "output_0_halo_broadcast_back",
-                "output_0_halo_inbound_top",
-                "output_0_halo_inbound_bottom",
-                "output_0_halo_inbound_left",
-                "output_0_halo_inbound_right",
-                "output_0_halo_inbound_front",
-                "output_0_halo_inbound_back",
-                "sep_enabled",
-                "sep_w",
-                "sep_h",
-                "sep_c",
-                "sep_b",
-                "sep_act_w",
-                "sep_act_h",
-                "sep_act_c",
-                "sep_act_b",
-                "sep_no_sparse_map",
-                "in_place_input1",    // not the same name as the attribute weightless_operation
-                "in_place_output",    // not the same name as the attribute in_place_output_memory
-                "superdense_output",  // not the same name as the attribute superdense
-                "input_autopad",
-                "output_autopad",
-                "mpe_engine",
-                "reduce_minmax_op",
-        };
 
-        return names;
+    static DimType get_weightless_operation(const DPUOperation& op) {
+        return op.weightless_operation;
     }
-
-    size_t hash() const {
-        std::size_t combined_hash = 0;
-        for (const auto& [key, value] : get_member_map()) {
-            std::visit(
-                    [&combined_hash](auto&& arg) {
-                        if constexpr (std::is_same_v<std::decay_t<std::remove_reference_t<decltype(arg)>>,
-                                                     VPUNN::SetGet_MemberMapValues>) {
-                            // arg have two parameters first one is false and that means that arg is in get_mode
-                            // (function will just return a value), second parameter could be any value, in get_mode
-                            // its value doesn't matter
-                            combined_hash ^= std::hash<int>{}(arg(false, "")) + 0x9e3779b9 + (combined_hash << 6) +
-                                             (combined_hash >> 2);
-                        } else {
-                            using argtype = std::decay_t<std::remove_reference_t<decltype(arg.get())>>;
-                            combined_hash ^= std::hash<argtype>{}(arg) + 0x9e3779b9 + (combined_hash << 6) +
-                                             (combined_hash >> 2);
-                        }
-                    },
-                    value);
-        }
-        return combined_hash;
+    static void set_weightless_operation(DPUOperation& op, const std::string& s) {
+        op.setWeightlessOperation(s);
+    }
+    static DimType get_in_place_output_memory(const DPUOperation& op) {
+        return op.in_place_output_memory;
+    }
+    static void set_in_place_output_memory(DPUOperation& op, const std::string& s) {
+        op.setInPlaceOutputMemory(s);
     }
 
+public:
+
     /// detect if operation is elementwise fammily
     bool is_elementwise_like_operation() const {
         return ((operation == Operation::ELTWISE) ||  //
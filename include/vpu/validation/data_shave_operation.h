@@ -13,14 +13,12 @@
 #include <functional>
 #include <iostream>
 #include <map>
-#include <mutex>
 #include <string>
-#include <unordered_map>
-#include <variant>
 #include <vector>
 
 #include "core/serializer.h"
 #include "vpu/dpu_types.h"
+#include "vpu/serialization/member_fields.h"
 #include "vpu/serializer_utils.h"
 #include "vpu/shave_workload.h"
 #include "vpu/validation/data_dpu_operation.h"
@@ -45,228 +43,96 @@ struct SHAVEOperation {
     std::array<std::string, 3> param_strings{};        ///< up to 3 parameters
     std::array<std::string, 9> extra_param_strings{};  ///< up to 9 extra parameters
 
-    using _ref_supported_type = std::variant<std::reference_wrapper<VPUDevice>, std::reference_wrapper<std::string>,
-                                             std::reference_wrapper<long long>, std::reference_wrapper<DataType>,
-                                             std::reference_wrapper<Layout>, std::reference_wrapper<bool>>;
-
-    using MemberMapType = std::unordered_map<std::string, _ref_supported_type>;
-
-    const MemberMapType& get_member_map() const {
-        ensure_member_map();
-        return _member_map;
-    }
-    MemberMapType& get_member_map() {
-        ensure_member_map();
-        return _member_map;
-    }
-
-private:
-    /** @brief Get the member map for serialization
-     * Cannot be generalized keys to more generic prefix_index_batch... prefix_index_channels...
-     * Because _member_map should be const to avoid accidental modification of this structure
-     * @return The member map for serialization
-     */
-    mutable MemberMapType _member_map{};
-
-    void populate_member_map() {
-        _member_map = MemberMapType{{"device", std::ref(device)},
-                                    {"operation", std::ref(operation)},
-                                    {"loc_name", std::ref(loc_name)},
-
-                                    // Input 0
-                                    {"input_0_batch", std::ref(input_tensors[0].batch)},
-                                    {"input_0_channels", std::ref(input_tensors[0].channels)},
-                                    {"input_0_height", std::ref(input_tensors[0].height)},
-                                    {"input_0_width", std::ref(input_tensors[0].width)},
-                                    {"input_0_datatype", std::ref(input_tensors[0].datatype)},
-                                    {"input_0_layout", std::ref(input_tensors[0].layout)},
-                                    {"input_0_sparsity_enabled", std::ref(input_tensors[0].sparsity_enabled)},
-
-                                    // Input 1
-                                    {"input_1_batch", std::ref(input_tensors[1].batch)},
-                                    {"input_1_channels", std::ref(input_tensors[1].channels)},
-                                    {"input_1_height", std::ref(input_tensors[1].height)},
-                                    {"input_1_width", std::ref(input_tensors[1].width)},
-                                    {"input_1_datatype", std::ref(input_tensors[1].datatype)},
-                                    {"input_1_layout", std::ref(input_tensors[1].layout)},
-                                    {"input_1_sparsity_enabled", std::ref(input_tensors[1].sparsity_enabled)},
-
-                                    // Input 2
-                                    {"input_2_batch", std::ref(input_tensors[2].batch)},
-                                    {"input_2_channels", std::ref(input_tensors[2].channels)},
-                                    {"input_2_height", std::ref(input_tensors[2].height)},
-                                    {"input_2_width", std::ref(input_tensors[2].width)},
-                                    {"input_2_datatype", std::ref(input_tensors[2].datatype)},
-                                    {"input_2_layout", std::ref(input_tensors[2].layout)},
-                                    {"input_2_sparsity_enabled", std::ref(input_tensors[2].sparsity_enabled)},
-
-                                    // Input 3
-                                    {"input_3_batch", std::ref(input_tensors[3].batch)},
-                                    {"input_3_channels", std::ref(input_tensors[3].channels)},
-                                    {"input_3_height", std::ref(input_tensors[3].height)},
-                                    {"input_3_width", std::ref(input_tensors[3].width)},
-                                    {"input_3_datatype", std::ref(input_tensors[3].datatype)},
-                                    {"input_3_layout", std::ref(input_tensors[3].layout)},
-                                    {"input_3_sparsity_enabled", std::ref(input_tensors[3].sparsity_enabled)},
-
-                                    // Input 4
-                                    {"input_4_batch", std::ref(input_tensors[4].batch)},
-                                    {"input_4_channels", std::ref(input_tensors[4].channels)},
-                                    {"input_4_height", std::ref(input_tensors[4].height)},
-                                    {"input_4_width", std::ref(input_tensors[4].width)},
-                                    {"input_4_datatype", std::ref(input_tensors[4].datatype)},
-                                    {"input_4_layout", std::ref(input_tensors[4].layout)},
-                                    {"input_4_sparsity_enabled", std::ref(input_tensors[4].sparsity_enabled)},
-
-                                    // Input 5
-                                    {"input_5_batch", std::ref(input_tensors[5].batch)},
-                                    {"input_5_channels", std::ref(input_tensors[5].channels)},
-                                    {"input_5_height", std::ref(input_tensors[5].height)},
-                                    {"input_5_width", std::ref(input_tensors[5].width)},
-                                    {"input_5_datatype", std::ref(input_tensors[5].datatype)},
-                                    {"input_5_layout", std::ref(input_tensors[5].layout)},
-                                    {"input_5_sparsity_enabled", std::ref(input_tensors[5].sparsity_enabled)},
-
-                                    // Input 6
-                                    {"input_6_batch", std::ref(input_tensors[6].batch)},
-                                    {"input_6_channels", std::ref(input_tensors[6].channels)},
-                                    {"input_6_height", std::ref(input_tensors[6].height)},
-                                    {"input_6_width", std::ref(input_tensors[6].width)},
-                                    {"input_6_datatype", std::ref(input_tensors[6].datatype)},
-                                    {"input_6_layout", std::ref(input_tensors[6].layout)},
-                                    {"input_6_sparsity_enabled", std::ref(input_tensors[6].sparsity_enabled)},
-
-                                    // Input 7
-                                    {"input_7_batch", std::ref(input_tensors[7].batch)},
-                                    {"input_7_channels", std::ref(input_tensors[7].channels)},
-                                    {"input_7_height", std::ref(input_tensors[7].height)},
-                                    {"input_7_width", std::ref(input_tensors[7].width)},
-                                    {"input_7_datatype", std::ref(input_tensors[7].datatype)},
-                                    {"input_7_layout", std::ref(input_tensors[7].layout)},
-                                    {"input_7_sparsity_enabled", std::ref(input_tensors[7].sparsity_enabled)},
-
-                                    // Output 0
-                                    {"output_0_batch", std::ref(output_tensors[0].batch)},
-                                    {"output_0_channels", std::ref(output_tensors[0].channels)},
-                                    {"output_0_height", std::ref(output_tensors[0].height)},
-                                    {"output_0_width", std::ref(output_tensors[0].width)},
-                                    {"output_0_datatype", std::ref(output_tensors[0].datatype)},
-                                    {"output_0_layout", std::ref(output_tensors[0].layout)},
-                                    {"output_0_sparsity_enabled", std::ref(output_tensors[0].sparsity_enabled)},
-
-                                    // Parameters
-                                    {"param_0", std::ref(param_strings[0])},
-                                    {"param_1", std::ref(param_strings[1])},
-                                    {"param_2", std::ref(param_strings[2])},
-
-                                    // Extra parameters
-                                    {"extra_param_0", std::ref(extra_param_strings[0])},
-                                    {"extra_param_1", std::ref(extra_param_strings[1])},
-                                    {"extra_param_2", std::ref(extra_param_strings[2])},
-                                    {"extra_param_3", std::ref(extra_param_strings[3])},
-                                    {"extra_param_4", std::ref(extra_param_strings[4])},
-                                    {"extra_param_5", std::ref(extra_param_strings[5])},
-                                    {"extra_param_6", std::ref(extra_param_strings[6])},
-                                    {"extra_param_7", std::ref(extra_param_strings[7])},
-                                    {"extra_param_8", std::ref(extra_param_strings[8])}};
-    }
-
-    mutable std::mutex _member_map_mutex{};
-    void ensure_member_map() const {
-        std::lock_guard<std::mutex> lock(_member_map_mutex);
-        if (is_member_map_initialized()) {
-            return;
-        }
-        (const_cast<SHAVEOperation*>(this))->populate_member_map();
-    }
-    bool is_member_map_initialized() const {
-        return !_member_map.empty();  // NOT empty
+    /// @brief compile time table of the serializable fields, in serialization order
+    static const auto& _get_member_fields() {
+        using Op = SHAVEOperation;
+        using T = TensorInfo;
+        static constexpr std::array fields{  // size deduced from the entries
+                field<Op, &Op::device>("device"),
+                field<Op, &Op::operation>("operation"),
+                field<Op, &Op::input_tensors, 0, &T::batch>("input_0_batch"),
+                field<Op, &Op::input_tensors, 0, &T::channels>("input_0_channels"),
+                field<Op, &Op::input_tensors, 0, &T::height>("input_0_height"),
+                field<Op, &Op::input_tensors, 0, &T::width>("input_0_width"),
+                field<Op, &Op::input_tensors, 1, &T::batch>("input_1_batch"),
+                field<Op, &Op::input_tensors, 1, &T::channels>("input_1_channels"),
+                field<Op, &Op::input_tensors, 1, &T::height>("input_1_height"),
+                field<Op, &Op::input_tensors, 1, &T::width>("input_1_width"),
+                field<Op, &Op::input_tensors, 2, &T::batch>("input_2_batch"),
+                field<Op, &Op::input_tensors, 2, &T::channels>("input_2_channels"),
+                field<Op, &Op::input_tensors, 2, &T::height>("input_2_height"),
+                field<Op, &Op::input_tensors, 2, &T::width>("input_2_width"),
+                field<Op, &Op::input_tensors, 3, &T::batch>("input_3_batch"),
+                field<Op, &Op::input_tensors, 3, &T::channels>("input_3_channels"),
+                field<Op, &Op::input_tensors, 3, &T::height>("input_3_height"),
+                field<Op, &Op::input_tensors, 3, &T::width>("input_3_width"),
+                field<Op, &Op::input_tensors, 4, &T::batch>("input_4_batch"),
+                field<Op, &Op::input_tensors, 4, &T::channels>("input_4_channels"),
+                field<Op, &Op::input_tensors, 4, &T::height>("input_4_height"),
+                field<Op, &Op::input_tensors, 4, &T::width>("input_4_width"),
+                field<Op, &Op::input_tensors, 5, &T::batch>("input_5_batch"),
+                field<Op, &Op::input_tensors, 5, &T::channels>("input_5_channels"),
+                field<Op, &Op::input_tensors, 5, &T::height>("input_5_height"),
+                field<Op, &Op::input_tensors, 5, &T::width>("input_5_width"),
+                field<Op, &Op::input_tensors, 6, &T::batch>("input_6_batch"),
+                field<Op, &Op::input_tensors, 6, &T::channels>("input_6_channels"),
+                field<Op, &Op::input_tensors, 6, &T::height>("input_6_height"),
+                field<Op, &Op::input_tensors, 6, &T::width>("input_6_width"),
+                field<Op, &Op::input_tensors, 7, &T::batch>("input_7_batch"),
+                field<Op, &Op::input_tensors, 7, &T::channels>("input_7_channels"),
+                field<Op, &Op::input_tensors, 7, &T::height>("input_7_height"),
+                field<Op, &Op::input_tensors, 7, &T::width>("input_7_width"),
+                field<Op, &Op::output_tensors, 0, &T::batch>("output_0_batch"),
+                field<Op, &Op::output_tensors, 0, &T::channels>("output_0_channels"),
+                field<Op, &Op::output_tensors, 0, &T::height>("output_0_height"),
+                field<Op, &Op::output_tensors, 0, &T::width>("output_0_width"),
+                field<Op, &Op::input_tensors, 0, &T::datatype>("input_0_datatype"),
+                field<Op, &Op::input_tensors, 0, &T::layout>("input_0_layout"),
+                field<Op, &Op::input_tensors, 0, &T::sparsity_enabled>("input_0_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 1, &T::datatype>("input_1_datatype"),
+                field<Op, &Op::input_tensors, 1, &T::layout>("input_1_layout"),
+                field<Op, &Op::input_tensors, 1, &T::sparsity_enabled>("input_1_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 2, &T::datatype>("input_2_datatype"),
+                field<Op, &Op::input_tensors, 2, &T::layout>("input_2_layout"),
+                field<Op, &Op::input_tensors, 2, &T::sparsity_enabled>("input_2_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 3, &T::datatype>("input_3_datatype"),
+                field<Op, &Op::input_tensors, 3, &T::layout>("input_3_layout"),
+                field<Op, &Op::input_tensors, 3, &T::sparsity_enabled>("input_3_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 4, &T::datatype>("input_4_datatype"),
+                field<Op, &Op::input_tensors, 4, &T::layout>("input_4_layout"),
+                field<Op, &Op::input_tensors, 4, &T::sparsity_enabled>("input_4_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 5, &T::datatype>("input_5_datatype"),
+                field<Op, &Op::input_tensors, 5, &T::layout>("input_5_layout"),
+                field<Op, &Op::input_tensors, 5, &T::sparsity_enabled>("input_5_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 6, &T::datatype>("input_6_datatype"),
+                field<Op, &Op::input_tensors, 6, &T::layout>("input_6_layout"),
+                field<Op, &Op::input_tensors, 6, &T::sparsity_enabled>("input_6_sparsity_enabled"),
+                field<Op, &Op::input_tensors, 7, &T::datatype>("input_7_datatype"),
+                field<Op, &Op::input_tensors, 7, &T::layout>("input_7_layout"),
+                field<Op, &Op::input_tensors, 7, &T::sparsity_enabled>("input_7_sparsity_enabled"),
+                field<Op, &Op::output_tensors, 0, &T::datatype>("output_0_datatype"),
+                field<Op, &Op::output_tensors, 0, &T::layout>("output_0_layout"),
+                field<Op, &Op::output_tensors, 0, &T::sparsity_enabled>("output_0_sparsity_enabled"),
+                field<Op, &Op::param_strings, 0>("param_0"),
+                field<Op, &Op::param_strings, 1>("param_1"),
+                field<Op, &Op::param_strings, 2>("param_2"),
+                field<Op, &Op::extra_param_strings, 0>("extra_param_0"),
+                field<Op, &Op::extra_param_strings, 1>("extra_param_1"),
+                field<Op, &Op::extra_param_strings, 2>("extra_param_2"),
+                field<Op, &Op::extra_param_strings, 3>("extra_param_3"),
+                field<Op, &Op::extra_param_strings, 4>("extra_param_4"),
+                field<Op, &Op::extra_param_strings, 5>("extra_param_5"),
+                field<Op, &Op::extra_param_strings, 6>("extra_param_6"),
+                field<Op, &Op::extra_param_strings, 7>("extra_param_7"),
+                field<Op, &Op::extra_param_strings, 8>("extra_param_8"),
+                field<Op, &Op::loc_name>("loc_name"),
+        };
+        return fields;
     }
 
-public:
-    /**
-     * Could be an idea to reuse _member_map keys, but function _get_member_names is
-     * declared static const, so it should be hard coded
-     */
-    static const std::vector<std::string> _get_member_names() {
-        return {"device",
-                "operation",
-                "input_0_batch",
-                "input_0_channels",
-                "input_0_height",
-                "input_0_width",
-                "input_1_batch",
-                "input_1_channels",
-                "input_1_height",
-                "input_1_width",
-                "input_2_batch",
-                "input_2_channels",
-                "input_2_height",
-                "input_2_width",
-                "input_3_batch",
-                "input_3_channels",
-                "input_3_height",
-                "input_3_width",
-                "input_4_batch",
-                "input_4_channels",
-                "input_4_height",
-                "input_4_width",
-                "input_5_batch",
-                "input_5_channels",
-                "input_5_height",
-                "input_5_width",
-                "input_6_batch",
-                "input_6_channels",
-                "input_6_height",
-                "input_6_width",
-                "input_7_batch",
-                "input_7_channels",
-                "input_7_height",
-                "input_7_width",
-                "output_0_batch",
-                "output_0_channels",
-                "output_0_height",
-                "output_0_width",
-                "input_0_datatype",
-                "input_0_layout",
-                "input_0_sparsity_enabled",
-                "input_1_datatype",
-                "input_1_layout",
-                "input_1_sparsity_enabled",
-                "input_2_datatype",
-                "input_2_layout",
-                "input_2_sparsity_enabled",
-                "input_3_datatype",
-                "input_3_layout",
-                "input_3_sparsity_enabled",
-                "input_4_datatype",
-                "input_4_layout",
-                "input_4_sparsity_enabled",
-                "input_5_datatype",
-                "input_5_layout",
-                "input_5_sparsity_enabled",
-                "input_6_datatype",
-                "input_6_layout",
-                "input_6_sparsity_enabled",
-                "input_7_datatype",
-                "input_7_layout",
-                "input_7_sparsity_enabled",
-                "output_0_datatype",
-                "output_0_layout",
-                "output_0_sparsity_enabled",
-                "param_0",
-                "param_1",
-                "param_2",
-                "extra_param_0",
-                "extra_param_1",
-                "extra_param_2",
-                "extra_param_3",
-                "extra_param_4",
-                "extra_param_5",
-                "extra_param_6",
-                "extra_param_7",
-                "extra_param_8",
-                "loc_name"};
+    static const std::vector<std::string>& _get_member_names() {
+        static const std::vector<std::string> names{member_field_names(_get_member_fields())};
+        return names;
     }
 
     static const std::string get_wl_name() {
@@ -49,8 +49,23 @@ public:
             return;
         }
 
-        const auto& config = get_config(wl.device);
+        check_and_sanitize(wl, get_config(wl.device), result);
+    }
+
+    /// @brief same as check_and_sanitize, for a device known at compile time: the configuration is not searched for
+    ///
+    /// @tparam DeviceValues the valid values of the device, @sa WorkloadValidValuesOf. wl.device must be one of its
+    /// devices
+    template <class DeviceValues>
+    void check_and_sanitize_for(DPUWorkload& wl, SanityReport& result) const {
+        result.resetOK();  // all OK
+        check_and_sanitize(wl, get_config_of<DeviceValues>(), result);
+    }
 
+private:
+    /// the checks and sanitization of check_and_sanitize, with the configuration of the device already known
+    template <class DeviceValues>
+    void check_and_sanitize(DPUWorkload& wl, const DeviceValues& config, SanityReport& result) const {
         // force execution mode when dCIM engine is selected
         if (wl.mpe_engine == MPEEngine::DCIM) {
             wl.execution_order = ExecutionMode::dCIM_32x128;
@@ -135,6 +150,7 @@ public:
         }
     }
 
+public:
     void check_data_consistency(DPUWorkload& wl, SanityReport& result) const {
         result.resetOK();  // all OK
         if (!is_supported(wl.device)) {
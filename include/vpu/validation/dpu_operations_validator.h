@@ -14,6 +14,7 @@
 
 #include <sstream>  // for error formating
 #include <stdexcept>
+#include <type_traits>
 
 #include <iostream>
 
@@ -330,6 +331,14 @@ using OperationsContext =
 
 using DPU_OperationValidator = DPU_ConfigurableOperationValidator<OperationsContext>;
 
+/// the valid values (of the OperationsContext) of a device known at compile time
+template <VPUDevice device>
+using WorkloadValidValuesOf = std::conditional_t<
+        (device <= VPUDevice::VPU_2_1), VPU2_0_WorkloadValidValues,
+        std::conditional_t<(device == VPUDevice::VPU_2_7), VPU2_7_WorkloadValidValues,
+                           std::conditional_t<(device == VPUDevice::VPU_4_0), VPU4_0_WorkloadValidValues,
+                                              VPURESERVEDorkloadValidValues>>>;
+
 /// using the same configuration for SHAVE for now, the DPU behaviour will not affect the Shave needs for memory
 /// calculation
 using SHAVE_OperationValidator = DPU_OperationValidator;
@@ -14,6 +14,7 @@
 #include <tuple>
 #include <vector>
 
+#include "core/executor.h"
 #include "core/persistent_cache.h"
 #include "core/serializer.h"
 #include "vpu/cycles_interface_types.h"
@@ -49,6 +50,8 @@ private:
 
     const HWPerformanceModel performance{};  // performance instance, not used here
 
+    std::shared_ptr<IExecutor> executor{std::make_shared<SerialExecutor>()};  ///< runs the internal parallel loops
+
 protected:
     // DPU cost providers
     const NNCostProvider dpu_nn_cost_provider;                      ///< NN cost provider for DPU
@@ -74,6 +77,8 @@ private:
     /// cache to store linearly extrapolation property of the NN. does not change after ctor!
     const bool is_linearly_extrapolation_necessary_cache_capability{
             dpu_nn_cost_provider.get_preprocessing().supportsProperty("DW_MXP_AVP_SupportsMoreThan64Ch")};
+
+protected:
     /**
      * @brief Ensures that input channels are equal to output channels for channel preserving operations
      *
@@ -81,6 +86,11 @@ private:
      */
     void channels_preserving_operations_consistency_check(DPUWorkload& workload) const;
 
+    /// @brief true if the DPU workloads are serialized (a csv line per DPU() call)
+    bool is_serialization_enabled() const noexcept {
+        return serializer.is_serialization_enabled();
+    }
+
 public:
     /// returns a reference of energy object
     /// owned by the current costmodel
@@ -127,6 +137,31 @@ public:
         return dpu_nn_cost_provider;
     }
 
+    /**
+     * @brief Attaches the executor used for the internal parallel loops (batched DPU inference, tiles of a layer,
+     * layers of a network). The default is serial.
+     *
+     * The executor is shared, e.g. one WorkStealingThreadPool for all the cost models of a compiler, or an adapter
+     * to the scheduler of the integration. Do not change it while the cost model is in use by other threads.
+     *
+     * @param new_executor the executor, nullptr goes back to serial execution
+     */
+    void set_executor(std::shared_ptr<IExecutor> new_executor) {
+        executor = new_executor ? std::move(new_executor) : std::make_shared<SerialExecutor>();
+    }
+
+    /// @brief the attached executor, see set_executor
+    IExecutor& get_executor() const noexcept {
+        return *executor;
+    }
+
+    /// @brief the executor for parallel loops that run DPU(): the attached one, or serial while the workloads are
+    /// serialized (the lines of the csv file must not interleave)
+    IExecutor& get_parallel_executor() const noexcept {
+        static SerialExecutor serial{};
+        return serializer.is_serialization_enabled() ? serial : *executor;
+    }
+
     /**
      * @brief Construct a new VPUCostModel object
      *
@@ -472,6 +507,13 @@ public:
      */
     float DPUEnergy(const DPUWorkload& wl) const;
 
+    /**
+     * @brief Compute the energy of multiple DPUWorkloads, @sa DPUEnergy for single wl for more explanations
+     * @param workloads a std::vector of DPUWorkload
+     * @return the energy of each workload, in the same order, measured  PowerVirus*cycle
+     */
+    std::vector<float> DPUEnergy(const std::vector<DPUWorkload>& workloads) const;
+
 public:
     /** @brief Compute the energy of a SHAVE SHAVEWorkload.
      * @details Energy here is a relative metric, but the activity factor of the operation multiplied by
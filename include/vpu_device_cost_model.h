@@ -0,0 +1,96 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPU_DEVICE_COST_MODEL_H
+#define VPU_DEVICE_COST_MODEL_H
+
+#include <string>
+#include <utility>
+
+#include "performance_mode.h"
+#include "vpu/hw_characteristics/device_HW_characteristics_const_repo.h"
+#include "vpu/validation/dpu_operations_validator.h"
+#include "vpu_cost_model.h"
+
+namespace VPUNN {
+
+/**
+ * @brief VPUCostModel specialized at compile time for one device, for integrations that target a single NPU.
+ *
+ * For workloads of the device the DPU() path has the device decisions taken at compile time: the valid values
+ * configuration of the sanitizer is the concrete type of the device (no search among the devices), the device
+ * dependent sanitization steps are resolved with if constexpr, and the HW characteristics are the constexpr values of
+ * the device, without the virtual IDeviceHWCharacteristics.
+ * The NN preprocessing and post-processing are selected by the interface version of the loaded .vpunn file, so they
+ * stay bound at load time.
+ *
+ * Workloads of other devices, and everything that is not DPU() of a single workload, use the generic (runtime
+ * dispatched) VPUCostModel, so the results are always the same as with VPUCostModel.
+ *
+ * @tparam D the device the model is specialized for
+ */
+template <VPUDevice D>
+class VPUDeviceCostModel : public VPUCostModel {
+    static_assert(D < VPUDevice::NPU_RESERVED_1, "No DPU valid values configuration for this device");
+
+public:
+    static constexpr VPUDevice device{D};  ///< the device of the specialization
+
+    using HWCharacteristics = HWCharacteristicsOf<D>;         ///< constexpr HW characteristics of the device
+    using ValidValues = WorkloadValidValuesOf<D>;             ///< sanitizer configuration of the device
+    static constexpr HWCharacteristics hw_characteristics{};  ///< the HW characteristics values
+
+    using VPUCostModel::VPUCostModel;
+    using VPUCostModel::DPU;
+
+    /// @brief same as VPUCostModel::DPU(DPUWorkload wl), specialized for the device
+    /* coverity[pass_by_value] */
+    CyclesInterfaceType DPU(DPUWorkload wl) const {
+        std::string dummy_info{};
+        return DPU(std::move(wl), dummy_info);
+    }
+
+    /// @brief same as VPUCostModel::DPU(DPUWorkload wl, std::string& info), specialized for the device
+    /* coverity[pass_by_value] */
+    CyclesInterfaceType DPU(DPUWorkload wl, std::string& info) const {
+        // other devices and the serialization of the workloads (csv line per call) take the generic path
+        if (wl.device != D || is_serialization_enabled()) {
+            return VPUCostModel::DPU(std::move(wl), info);
+        }
+
+        if constexpr (!PerformanceMode::allowLegacySwizzling_G5 && D >= VPUDevice::NPU_5_0) {
+            wl.set_all_swizzlings(Swizzling::KEY_0);  // swizz guard sanitization
+        }
+
+        SanityReport problems{};
+        const bool is_inference_relevant{sanitize_workload_for_device(wl, problems)};
+        info = problems.info;
+        if (!is_inference_relevant) {
+            return problems.value();
+        }
+        return get_cost(wl, info);
+    }
+
+private:
+    /// @brief same as VPUCostModel::sanitize_workload, the device checks are resolved at compile time
+    bool sanitize_workload_for_device(DPUWorkload& workload, SanityReport& result) const {
+        avgpool_replace_by(workload);
+        if constexpr (D >= VPUDevice::VPU_2_7) {
+            compressConv_replace_by_CM_CONV_VPU27(workload);
+        }
+        channels_preserving_operations_consistency_check(workload);
+
+        sanitizer.template check_and_sanitize_for<ValidValues>(workload, result);
+        return result.is_usable();
+    }
+};
+
+}  // namespace VPUNN
+
+#endif  // VPU_DEVICE_COST_MODEL_H
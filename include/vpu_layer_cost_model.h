@@ -20,6 +20,7 @@
 #include "vpu/cycles_interface_types.h"
 #include "vpu/layer.h"
 #include "vpu/layer_split_info.h"
+#include "vpu/optimization/intra_tile_split_memo.h"
 #include "vpu/types.h"
 #include "vpu/vpu_tiling_strategy.h"
 #include "vpu_cost_model.h"
@@ -30,6 +31,8 @@ namespace VPUNN {
 
 /// @brief The VPUNN layer cost model (also called VPUNN Level2 API)
 class VPUNN_API VPULayerCostModel {
+    friend class VPULayerCostSession;  ///< reuses the tile results between calls
+
 private:
     /// DPU cost provider, used for DPU workloads
     std::shared_ptr<VPUCostModel> ptr_internal_dpu_cost_provider;  //< shared ownership of L1 , either received from
@@ -40,6 +43,9 @@ private:
     const LayersValidation the_layer_validator{};  ///< used for validating the un-split layers and split layers
     static constexpr unsigned int default_maxWorkloadsPerIntraTileSplit{128U};  ///< default max splits for a tile
     unsigned int maxWorkloadsPerIntraTileSplit{default_maxWorkloadsPerIntraTileSplit};  ///< max splits for a tile
+    bool pruneIntraTileSplits{false};  ///< intra-tile split search skips splits that cannot win (lower bound)
+    SplitDetailLevel splitDetailLevel{SplitDetailLevel::ALL};  ///< intra-tile splits kept in a LayerSplitInfo
+    unsigned int splitDetailTopK{8U};                          ///< kept splits for SplitDetailLevel::TOP_K
 
     const DMACostModelVariant the_dma_cost_model{static_cast<DMACostModel<DMANNWorkload_NPU27>*>(
             nullptr)};  ///< Variant that holds a DMACostModel pointer (non const). External provider!
@@ -99,6 +105,20 @@ public:
         return serializer;
     }
 
+    /// @brief Attaches the executor for the internal parallel loops, to the contained DPU cost model.
+    /// @sa VPUCostModel::set_executor. The contained cost model may be shared with other layer models.
+    void set_executor(std::shared_ptr<IExecutor> executor) {
+        internal_dpu_cost_provider.set_executor(std::move(executor));
+    }
+
+    /// @brief the executor for parallel loops that run Layer(): the attached one, or serial while the layers or
+    /// the workloads are serialized
+    IExecutor& get_parallel_executor() const noexcept {
+        static SerialExecutor serial{};
+        const bool serializing{serializer.is_serialization_enabled() || presplit_serializer.is_serialization_enabled()};
+        return serializing ? serial : internal_dpu_cost_provider.get_parallel_executor();
+    }
+
     //////////////////// Constructors section
 
     /// In order to inject a DMACostModel, need to extend base constructor
@@ -247,6 +267,24 @@ public:
         return maxWorkloadsPerIntraTileSplit;
     }
 
+    /// @brief enables the pruned intra-tile split search, @see SplitOptions::pruneSplits
+    void set_pruneIntraTileSplits(bool new_value) noexcept {
+        pruneIntraTileSplits = new_value;
+    }
+    auto get_pruneIntraTileSplits() const noexcept {
+        return pruneIntraTileSplits;
+    }
+
+    /// @brief which intra-tile splits are kept in the all_intra_tile_splits of a LayerSplitInfo requested by the
+    /// caller, @see SplitDetailLevel. Without a LayerSplitInfo no split is kept, with CSV serialization all are kept
+    void set_splitDetailLevel(SplitDetailLevel level, unsigned int top_k = 8U) noexcept {
+        splitDetailLevel = level;
+        splitDetailTopK = top_k;
+    }
+    auto get_splitDetailLevel() const noexcept {
+        return splitDetailLevel;
+    }
+
     /**
      * @brief Compute the optimal cost of a DPULayer given a strategy and context
      *
@@ -394,12 +432,15 @@ protected:
      * weights tensors, that are pipelined on all available DMA channels.
      * @param detailed_split [out] gives as output the information on how was split this layer and what is the best
      * split on workloads. ignored if null
+     * @param tile_memo [in/out] intra-tile split results of tiles seen before, reused and completed with the new tiles.
+     * ignored if null
      * @return measured best cycles or error code. \see Cycles for error codes
      */
     CyclesInterfaceType layer_cycles(VPUCostModel& dpu_cost_provider,  // cost model to be used
                                      DPULayer& layer, VPUTilingStrategy strategy, unsigned int nDPU = 1,
                                      unsigned int nTiles = 1, bool input_in_ddr = false, bool output_in_ddr = false,
-                                     bool prefetching = true, LayerSplitInfo* detailed_split = nullptr) const;
+                                     bool prefetching = true, LayerSplitInfo* detailed_split = nullptr,
+                                     IntraTileSplitMemo* tile_memo = nullptr) const;
 
     /// like Layer but with pre-split layers
     CyclesInterfaceType layer_pre_split_cycles(
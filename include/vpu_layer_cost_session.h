@@ -0,0 +1,77 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#ifndef VPUNN_LAYER_COST_SESSION_H
+#define VPUNN_LAYER_COST_SESSION_H
+
+#include <cstddef>
+
+#include "vpu/cycles_interface_types.h"
+#include "vpu/layer.h"
+#include "vpu/layer_split_info.h"
+#include "vpu/optimization/intra_tile_split_memo.h"
+#include "vpu_layer_cost_model.h"
+#include "vpu_layer_strategy.h"
+
+namespace VPUNN {
+
+/**
+ * @brief Incremental costing of layers that are close variations of each other, on top of a VPULayerCostModel.
+ *
+ * Intended for strategy search loops that ask repeatedly about layers that differ from a previous query in a single
+ * attribute (e.g. a different nTiles, input/output in DDR, one output dimension). The session remembers the
+ * intra-tile split result (best split, all candidates and their per workload cycles) of each tile layer it costed.
+ * When a query produces a tile that was already split, the remembered result is reused, only the new tiles are
+ * split and costed. Inside a new tile, the workloads already inferred hit the DPU cost model cache.
+ *
+ * The result of a query is the same as the one of VPULayerCostModel::Layer with the same arguments. The intra-tile
+ * split options (max workloads, split pruning, detail level) are part of the remembered key, but a change of the DPU model used
+ * by the layer cost model is not detected: call clear() after such a change.
+ * Not thread safe, one session per search thread.
+ */
+class VPUNN_API VPULayerCostSession {
+public:
+    /// @brief statistics of the session
+    struct Stats {
+        std::size_t layers{0};        ///< layers costed
+        std::size_t tiles_costed{0};  ///< tile layers that were split and costed
+        std::size_t tiles_reused{0};  ///< tile layers whose split was reused from a previous query
+        std::size_t tiles_stored{0};  ///< tile layers currently remembered
+    };
+
+    /**
+     * @brief Construct a new session
+     *
+     * @param layer_model the layer cost model used for costing, must outlive the session
+     * @param max_tiles max number of tile results remembered, oldest are forgotten first
+     */
+    explicit VPULayerCostSession(VPULayerCostModel& layer_model,
+                                 std::size_t max_tiles = IntraTileSplitMemo::default_capacity);
+
+    /// @brief same as VPULayerCostModel::Layer(layer, strategy)
+    CyclesInterfaceType Layer(DPULayer& layer, const VPULayerStrategy& strategy);
+
+    /// @brief same as VPULayerCostModel::Layer(layer, strategy, detailed_split)
+    CyclesInterfaceType Layer(DPULayer& layer, const VPULayerStrategy& strategy, LayerSplitInfo& detailed_split);
+
+    /// @brief statistics since construction or last clear
+    Stats get_stats() const;
+
+    /// @brief forgets all the remembered tiles
+    void clear();
+
+private:
+    VPULayerCostModel& model;      ///< the costing is delegated to it
+    IntraTileSplitMemo tile_memo;  ///< tile results of this session
+    std::size_t layers_costed{0};  ///< number of Layer calls
+};
+
+}  // namespace VPUNN
+
+#endif  // VPUNN_LAYER_COST_SESSION_H
@@ -0,0 +1,179 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include "core/executor.h"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace VPUNN {
+
+/// a running parallel_for, lives on the stack of the caller until all its chunks are done
+struct WorkStealingThreadPool::Job {
+    const std::function<void(std::size_t)>& body;
+    std::atomic<std::size_t> remaining;  ///< chunks not finished
+    std::mutex error_mutex;              ///< protects error
+    std::exception_ptr error{};          ///< first exception of the body
+
+    Job(const std::function<void(std::size_t)>& body, const std::size_t chunks): body{body}, remaining{chunks} {
+    }
+};
+
+namespace {
+constexpr std::size_t no_queue{std::numeric_limits<std::size_t>::max()};
+constexpr std::size_t chunks_per_thread{4};  ///< more chunks than threads, to balance uneven iterations
+
+thread_local const WorkStealingThreadPool* current_pool{nullptr};  ///< the pool of the current worker thread
+thread_local std::size_t current_queue{no_queue};                  ///< the queue of the current worker thread
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(const Options& options) {
+    unsigned int threads{options.threads};
+    if (threads == 0) {
+        const unsigned int hardware{std::thread::hardware_concurrency()};
+        threads = (hardware > 1) ? hardware - 1 : 0;
+    }
+
+    for (unsigned int idx = 0; idx < threads; idx++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (std::size_t idx = 0; idx < threads; idx++) {
+        workers.emplace_back([this, idx]() {
+            worker_loop(idx);
+        });
+#if defined(__linux__)
+        if (!options.cpu_affinity.empty()) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(options.cpu_affinity[idx % options.cpu_affinity.size()], &cpus);
+            pthread_setaffinity_np(workers.back().native_handle(), sizeof(cpu_set_t), &cpus);  // best effort
+        }
+#endif
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};
+        stop = true;
+    }
+    sleep_cv.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingThreadPool::parallel_for(const std::size_t count, const std::function<void(std::size_t)>& body) {
+    if (workers.empty() || count <= 1) {
+        for (std::size_t idx = 0; idx < count; idx++) {
+            body(idx);
+        }
+        return;
+    }
+
+    const std::size_t chunks{std::min(count, concurrency() * chunks_per_thread)};
+    Job job{body, chunks};
+    const std::size_t first_queue{next_queue.fetch_add(1, std::memory_order_relaxed)};
+    for (std::size_t c = 0; c < chunks; c++) {
+        auto& queue{*queues[(first_queue + c) % queues.size()]};
+        {
+            std::lock_guard<std::mutex> lock{queue.mutex};
+            queue.chunks.push_back({&job, count * c / chunks, count * (c + 1) / chunks});
+        }
+        queued.fetch_add(1, std::memory_order_release);
+    }
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};  // no worker misses the notification
+    }
+    sleep_cv.notify_all();
+
+    // the caller works too, also on other jobs, until all chunks of its job are done
+    const std::size_t own_queue{(current_pool == this) ? current_queue : no_queue};
+    while (job.remaining.load(std::memory_order_acquire) > 0) {
+        if (!run_one(own_queue)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+void WorkStealingThreadPool::worker_loop(const std::size_t own_queue) {
+    current_pool = this;
+    current_queue = own_queue;
+    for (;;) {
+        if (run_one(own_queue)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{sleep_mutex};
+        sleep_cv.wait(lock, [this]() {
+            return stop || queued.load(std::memory_order_acquire) > 0;
+        });
+        if (stop && queued.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+bool WorkStealingThreadPool::run_one(const std::size_t own_queue) {
+    Chunk chunk{nullptr, 0, 0};
+    if (own_queue != no_queue) {
+        auto& queue{*queues[own_queue]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.chunks.empty()) {
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+        }
+    }
+    const std::size_t start{(own_queue != no_queue) ? own_queue + 1 : 0};
+    for (std::size_t i = 0; chunk.job == nullptr && i < queues.size(); i++) {
+        const std::size_t victim{(start + i) % queues.size()};
+        if (victim == own_queue) {
+            continue;
+        }
+        auto& queue{*queues[victim]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (!queue.chunks.empty()) {
+            chunk = queue.chunks.front();
+            queue.chunks.pop_front();
+            steals.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (chunk.job == nullptr) {
+        return false;
+    }
+    queued.fetch_sub(1, std::memory_order_acq_rel);
+    run_chunk(chunk);
+    return true;
+}
+
+void WorkStealingThreadPool::run_chunk(const Chunk& chunk) {
+    Job& job{*chunk.job};
+    try {
+        for (std::size_t idx = chunk.begin; idx < chunk.end; idx++) {
+            job.body(idx);
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock{job.error_mutex};
+        if (!job.error) {
+            job.error = std::current_exception();
+        }
+    }
+    job.remaining.fetch_sub(1, std::memory_order_acq_rel);  // the job may end here, not used anymore
+}
+
+}  // namespace VPUNN
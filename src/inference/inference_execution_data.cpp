@@ -21,7 +21,8 @@
 
 namespace VPUNN {
 
-void InferenceExecutionData::allocate_tensorsMapAndBias(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel) {
+void InferenceExecutionData::allocate_tensorsMapAndBias(const unsigned int batch, const VPUNN_SCHEMA::Model* theModel,
+                                                        const bool with_constants) {
     const auto tensors = theModel->tensors();
     const auto buffers = theModel->buffers();
 
@@ -33,6 +34,11 @@ void InferenceExecutionData::allocate_tensorsMapAndBias(const unsigned int batch
         // we use the batch only for buffers that are not stored in model (dynamic tensors)
         const uint32_t forced_batch{(buffer_is_present) ? 1 : batch};
 
+        if (buffer_is_present && !with_constants) {  // shared by the model, keep only the index
+            tensor_map.emplace_back(Tensor<float>{std::vector<unsigned int>{0}});  // empty placeholder
+            continue;
+        }
+
         const auto tensor_shape{parse_vector(flatbuffer_tensor->shape(), forced_batch)};
 
         {                                        // Create/Fill the new tensor structure
@@ -9,6 +9,11 @@
 
 #include "inference/model.h"
 
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "core/shared_registry.h"
 #include "kernels/bias.h"
 #include "kernels/fully_connected.h"
 #include "kernels/kNN.h"
@@ -18,9 +23,35 @@
 
 namespace VPUNN {
 
+namespace {
+/// @brief the model files that passed the flatbuffer verification in this process, by file identity (path, size and
+/// modification time). An unchanged file is trusted when it is loaded again and is not verified twice
+class VerifiedModelFiles {
+public:
+    static bool contains(const std::string& identity) {
+        std::lock_guard<std::mutex> lock{mutex()};
+        return identities().count(identity) > 0;
+    }
+    static void add(const std::string& identity) {
+        std::lock_guard<std::mutex> lock{mutex()};
+        identities().insert(identity);
+    }
 
+private:
+    static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+    }
+    static std::unordered_set<std::string>& identities() {
+        static std::unordered_set<std::string> verified;
+        return verified;
+    }
+};
+}  // namespace
 
-InferenceModel::InferenceModel(const char* filename): initialized(false) {
+InferenceModel::InferenceModel(const char* filename, const WeightsPrecision precision)
+        : initialized(false), weights_precision(precision) {
+    const std::string identity{file_identity(filename)};  // before reading, a later change makes another identity
     std::ifstream myFile;
 
     myFile.open(filename, std::ios::binary | std::ios::in);
@@ -37,16 +68,22 @@ InferenceModel::InferenceModel(const char* filename): initialized(false) {
     myFile.read(buffer_for_model.data(), length);
     myFile.close();
 
-    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(buffer_for_model.data()), buffer_for_model.size());
-    if (!(VPUNN_SCHEMA::VerifyModelBuffer(verifier))) {
-        return;
+    if (!VerifiedModelFiles::contains(identity)) {
+        flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(buffer_for_model.data()),
+                                       buffer_for_model.size());
+        if (!(VPUNN_SCHEMA::VerifyModelBuffer(verifier))) {
+            return;
+        }
+        VerifiedModelFiles::add(identity);
     }
 
     model = VPUNN_SCHEMA::GetModel(buffer_for_model.data());
     initialized = true;
+    compile_constants();
 }
 
-InferenceModel::InferenceModel(const char* data, size_t length, bool with_copy): initialized(false) {
+InferenceModel::InferenceModel(const char* data, size_t length, bool with_copy, const WeightsPrecision precision)
+        : initialized(false), weights_precision(precision) {
     flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(data), length);
     if (!(VPUNN_SCHEMA::VerifyModelBuffer(verifier))) {
         return;
@@ -60,6 +97,111 @@ InferenceModel::InferenceModel(const char* data, size_t length, bool with_copy):
     }
 
     initialized = true;
+    compile_constants();
+}
+
+void InferenceModel::compile_constants() {
+    const auto tensors = model->tensors();
+    const auto buffers = model->buffers();
+    const auto layers = model->operators();
+
+    try {
+        std::vector<std::unique_ptr<const Tensor<float>>> constants(tensors->size());
+        for (flatbuffers::uoffset_t idx = 0; idx < tensors->size(); idx++) {
+            const auto flatbuffer_tensor{tensors->Get(idx)};
+            const uint32_t buffer_ID = flatbuffer_tensor->buffer();
+            constexpr uint32_t NOT_EXISTING{0};
+            if (buffer_ID == NOT_EXISTING) {
+                continue;  // activation, allocated by each execution data
+            }
+            std::vector<unsigned int> shape;
+            for (auto it = flatbuffer_tensor->shape()->cbegin(); it != flatbuffer_tensor->shape()->cend(); ++it) {
+                shape.push_back(*it);
+            }
+            auto tensor{std::make_unique<Tensor<float>>(shape)};
+            const auto array = buffers->Get(buffer_ID)->data();
+            tensor->assign((const float*)(array->data()), array->size());  // throws if mismatch with the shape
+            constants[idx] = std::move(tensor);
+        }
+
+        auto is_constant = [&constants](const int32_t idx) {
+            return idx >= 0 && idx < static_cast<int32_t>(constants.size()) && constants[idx] != nullptr;
+        };
+
+        // FC weights are packed, the other uses of constants need the tensor as it is
+        std::vector<std::unique_ptr<const PackedDenseWeights>> packed(layers->size());
+        std::vector<bool> used_as_tensor(constants.size(), false);
+        for (flatbuffers::uoffset_t op = 0; op < layers->size(); op++) {
+            const auto layer{layers->Get(op)};
+            const auto inputs{layer->inputs()};
+            for (flatbuffers::uoffset_t pos = 0; pos < inputs->size(); pos++) {
+                const auto tensor_idx{inputs->Get(pos)};
+                if (!is_constant(tensor_idx)) {
+                    continue;
+                }
+                const bool fc_weights{layer->implementation_type() == VPUNN_SCHEMA::LayerType_FullyConnectedLayer &&
+                                      pos == 1};
+                if (fc_weights) {
+                    // same dimensions as Dense uses: from the activations, [batch, channels]
+                    const auto activation_idx{inputs->Get(0)};
+                    const auto output_idx{layer->outputs()->Get(0)};
+                    if (activation_idx < 0 || activation_idx >= static_cast<int32_t>(tensors->size()) ||
+                        output_idx < 0 || output_idx >= static_cast<int32_t>(tensors->size())) {
+                        throw std::runtime_error("FC layer activations are not model tensors");
+                    }
+                    const auto activation_shape{tensors->Get(activation_idx)->shape()};
+                    const auto output_shape{tensors->Get(output_idx)->shape()};
+                    if (activation_shape->size() != 2 || output_shape->size() != 2) {
+                        throw std::runtime_error("FC layer activations are not 2D");
+                    }
+                    packed[op] = std::make_unique<const PackedDenseWeights>(*constants[tensor_idx],
+                                                                            output_shape->Get(1),
+                                                                            activation_shape->Get(1),
+                                                                            weights_precision);
+                } else {
+                    used_as_tensor[tensor_idx] = true;
+                }
+            }
+        }
+        for (size_t idx = 0; idx < constants.size(); idx++) {
+            if (!used_as_tensor[idx]) {
+                constants[idx].reset();  // only the packed form is needed
+            }
+        }
+
+        shared_constants = std::move(constants);
+        packed_dense = std::move(packed);
+    } catch (const std::exception& e) {
+        Logger::warning() << "Model constants cannot be shared, each inference keeps its own copy: " << e.what();
+        shared_constants.clear();
+        packed_dense.clear();
+        weights_precision = WeightsPrecision::FP32;  // the reference kernels are used
+    }
+}
+
+std::size_t InferenceModel::shared_constants_bytes() const {
+    std::size_t bytes{0};
+    for (const auto& tensor : shared_constants) {
+        bytes += tensor ? static_cast<std::size_t>(tensor->size()) * sizeof(float) : 0;
+    }
+    for (const auto& weights : packed_dense) {
+        bytes += weights ? weights->size_in_bytes() : 0;
+    }
+    return bytes;
+}
+
+std::vector<const Tensor<float>*> InferenceModel::layer_inputs(const flatbuffers::Vector<int32_t>* tensors,
+                                                               const InferenceExecutionData& execution_memory) const {
+    std::vector<const Tensor<float>*> result;
+    for (auto it = tensors->cbegin(); it != tensors->cend(); ++it) {
+        const auto idx{*it};
+        if (idx >= 0 && idx < static_cast<int32_t>(shared_constants.size()) && shared_constants[idx]) {
+            result.push_back(shared_constants[idx].get());
+        } else if (idx >= 0 && idx < static_cast<int32_t>(execution_memory.tensor_map.size())) {
+            result.push_back(&(execution_memory.tensor_map[idx]));
+        }
+    }
+    return result;
 }
 
 void InferenceModel::predict(InferenceExecutionData& execution_memory) const {
@@ -68,19 +210,25 @@ void InferenceModel::predict(InferenceExecutionData& execution_memory) const {
     for (flatbuffers::uoffset_t idx = 0; idx < layers->size(); idx++) {
         // Create the new tensor structure
         const auto layer{layers->Get(idx)};
-        auto inputs{execution_memory.get_ro_tensors_from_index(layer->inputs())};
+        auto inputs{layer_inputs(layer->inputs(), execution_memory)};
         auto outputs{execution_memory.get_rw_tensors_from_index(layer->outputs())};
         auto& biasBuf{execution_memory.bias};
+        const PackedDenseWeights* packed_weights{idx < packed_dense.size() ? packed_dense[idx].get() : nullptr};
 
-        run_layer(layer, inputs, outputs, biasBuf);
+        run_layer(layer, inputs, outputs, packed_weights, biasBuf);
     }
 }
 
 void InferenceModel::run_layer(const VPUNN_SCHEMA::Layer* layer, const std::vector<const Tensor<float>*>& inputs,
-                               const std::vector<Tensor<float>*>& outputs, BiasOpBuffer& biasBuf) const {
+                               const std::vector<Tensor<float>*>& outputs, const PackedDenseWeights* packed_weights,
+                               BiasOpBuffer& biasBuf) const {
     switch (layer->implementation_type()) {
     case VPUNN_SCHEMA::LayerType_FullyConnectedLayer:
         // inputs: activations, weights, bias
+        if (packed_weights) {  // bias is added by the kernel
+            Dense(*packed_weights, inputs[0], outputs[0], (inputs.size() > 2) ? inputs[2] : nullptr);
+            break;
+        }
         Dense(inputs[1], inputs[0], outputs[0]);
 
         if (inputs.size() > 2) {
@@ -8,6 +8,14 @@
 // Software Package for additional details.
 
 #include "kernels/fully_connected.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
 #include "kernels/vpunn_blas.h"
 
 void VPUNN::Dense(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float>* activations,
@@ -22,3 +30,235 @@ void VPUNN::Dense(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float
                 activations->c_ptr(), input_channels, weights->c_ptr(), input_channels, 0.0F, output->data(),
                 output_channels);
 }
+
+std::string_view VPUNN::to_string(const VPUNN::WeightsPrecision precision) {
+    switch (precision) {
+    case WeightsPrecision::BF16:
+        return "BF16";
+    case WeightsPrecision::INT8:
+        return "INT8";
+    default:
+        return "FP32";
+    }
+}
+
+VPUNN::WeightsPrecision VPUNN::weights_precision_from_string(std::string_view text) {
+    for (const auto precision : {WeightsPrecision::BF16, WeightsPrecision::INT8}) {
+        if (text == to_string(precision)) {
+            return precision;
+        }
+    }
+    return WeightsPrecision::FP32;
+}
+
+namespace {
+template <typename T>
+T* aligned_array(const std::size_t elements) {
+    return static_cast<T*>(
+            ::operator new[](elements * sizeof(T), std::align_val_t{VPUNN::PackedDenseWeights::alignment_bytes}));
+}
+
+/// bfloat16 bits of a float, round to nearest even (NaN stays NaN)
+std::uint16_t to_bf16(const float value) {
+    std::uint32_t bits{0};
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (std::isnan(value)) {
+        return static_cast<std::uint16_t>((bits >> 16) | 0x0040U);
+    }
+    bits += 0x7FFFU + ((bits >> 16) & 1U);
+    return static_cast<std::uint16_t>(bits >> 16);
+}
+}  // namespace
+
+VPUNN::PackedDenseWeights::PackedDenseWeights(const VPUNN::Tensor<float>& weights, const int output_channels,
+                                              const int input_channels, const WeightsPrecision precision)
+        : n_outputs{output_channels},
+          n_inputs{input_channels},
+          weights_precision{precision},
+          data{nullptr},
+          data_bf16{nullptr},
+          data_int8{nullptr} {
+    if (output_channels <= 0 || input_channels <= 0 || weights.size() != output_channels * input_channels) {
+        std::stringstream buffer;
+        buffer << "[ERROR]PackedDenseWeights: weights size: " << weights.size() << " is not output_channels("
+               << output_channels << ") x input_channels(" << input_channels << ")";
+        throw std::runtime_error(buffer.str());
+    }
+    const std::size_t elements{static_cast<std::size_t>(panels()) * n_inputs * panel_width};
+    const float* src{weights.c_ptr()};
+
+    // symmetric quantization per output channel and group of input channels, stored like the panels. The zero
+    // groups (and the padding) keep a unit scale
+    auto scale_index = [this](const int out_ch, const int k) {
+        return (static_cast<std::size_t>(out_ch / panel_width) * int8_groups() + k / int8_group_size) * panel_width +
+               out_ch % panel_width;
+    };
+    if (precision == WeightsPrecision::INT8) {
+        scales.assign(static_cast<std::size_t>(panels()) * int8_groups() * panel_width, 1.0F);
+        for (int out_ch = 0; out_ch < n_outputs; out_ch++) {
+            const float* row{src + static_cast<std::size_t>(out_ch) * n_inputs};
+            for (int first = 0; first < n_inputs; first += int8_group_size) {
+                float max_abs{0.0F};
+                for (int k = first; k < std::min(first + int8_group_size, n_inputs); k++) {
+                    max_abs = std::max(max_abs, std::abs(row[k]));
+                }
+                if (max_abs > 0.0F) {
+                    scales[scale_index(out_ch, first)] = max_abs / 127.0F;
+                }
+            }
+        }
+    }
+
+    auto pack = [this, src](auto* dst, auto convert) {
+        for (int p = 0; p < panels(); p++) {
+            auto* panel_dst{dst + panel_offset(p)};
+            for (int k = 0; k < n_inputs; k++) {
+                for (int j = 0; j < panel_width; j++) {
+                    const int out_ch{p * panel_width + j};
+                    panel_dst[k * panel_width + j] =
+                            convert(out_ch, k, (out_ch < n_outputs) ? src[out_ch * n_inputs + k] : 0.0F);
+                }
+            }
+        }
+    };
+
+    switch (precision) {
+    case WeightsPrecision::BF16:
+        data_bf16.reset(aligned_array<std::uint16_t>(elements));
+        pack(data_bf16.get(), [](int, int, float w) {
+            return to_bf16(w);
+        });
+        break;
+    case WeightsPrecision::INT8:
+        data_int8.reset(aligned_array<std::int8_t>(elements));
+        pack(data_int8.get(), [this, &scale_index](int out_ch, int k, float w) {
+            const float q{std::round(w / scales[scale_index(out_ch, k)])};
+            return static_cast<std::int8_t>(std::clamp(q, -127.0F, 127.0F));
+        });
+        break;
+    default:
+        weights_precision = WeightsPrecision::FP32;
+        data.reset(aligned_array<float>(elements));
+        pack(data.get(), [](int, int, float w) {
+            return w;
+        });
+        break;
+    }
+}
+
+namespace {
+/// rows of the activations processed together, each weights panel element loaded once is used for all of them
+constexpr int rows_block{4};
+
+inline float to_float(const float w) {
+    return w;
+}
+inline float to_float(const std::uint16_t w) {  // bfloat16 is the upper half of a float
+    const std::uint32_t bits{static_cast<std::uint32_t>(w) << 16};
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+inline float to_float(const std::int8_t w) {
+    return static_cast<float>(w);
+}
+
+/// C[rows, panel] = A[rows, K] * panel[K, panel_width] (+ bias), for rows <= rows_block
+/// The accumulation over K is in order for each output, the compiler vectorizes over the panel width. The weights
+/// are converted to float (and int8 ones scaled) when loaded
+template <int rows, typename W>
+void dense_micro_kernel(const float* a, const int lda, const W* panel, const int K, float* c, const int ldc,
+                        const int columns, const float* scales, const float* bias) {
+    constexpr int NR{VPUNN::PackedDenseWeights::panel_width};
+    float acc[rows][NR] = {};
+    for (int k = 0; k < K; k++) {
+        const W* w{panel + k * NR};
+        float w_k[NR];
+        if constexpr (std::is_same_v<W, std::int8_t>) {
+            const float* s_k{scales + (k / VPUNN::PackedDenseWeights::int8_group_size) * NR};
+            for (int j = 0; j < NR; j++) {
+                w_k[j] = to_float(w[j]) * s_k[j];
+            }
+        } else {
+            for (int j = 0; j < NR; j++) {
+                w_k[j] = to_float(w[j]);
+            }
+        }
+        for (int r = 0; r < rows; r++) {
+            const float a_rk{a[r * lda + k]};
+            for (int j = 0; j < NR; j++) {
+                acc[r][j] += a_rk * w_k[j];
+            }
+        }
+    }
+    for (int r = 0; r < rows; r++) {
+        for (int j = 0; j < columns; j++) {
+            c[r * ldc + j] = (bias != nullptr) ? acc[r][j] + bias[j] : acc[r][j];
+        }
+    }
+}
+
+/// all panels, panel_of(p) gives the panel data in the stored precision
+template <typename W, typename PanelOf>
+void dense_packed(const VPUNN::PackedDenseWeights& weights, PanelOf panel_of, const float* A, const int batch_size,
+                  float* C, const float* bias_data) {
+    constexpr int NR{VPUNN::PackedDenseWeights::panel_width};
+    const int output_channels{weights.output_channels()};
+    const int input_channels{weights.input_channels()};
+
+    for (int p = 0; p < weights.panels(); p++) {
+        const int first_col{p * NR};
+        const int columns{std::min(NR, output_channels - first_col)};
+        const W* panel{panel_of(p)};
+        const float* scales{weights.panel_scales(p)};
+        const float* panel_bias{bias_data ? bias_data + first_col : nullptr};
+
+        int row = 0;
+        for (; row + rows_block <= batch_size; row += rows_block) {
+            dense_micro_kernel<rows_block>(A + row * input_channels, input_channels, panel, input_channels,
+                                           C + row * output_channels + first_col, output_channels, columns, scales,
+                                           panel_bias);
+        }
+        for (; row < batch_size; row++) {
+            dense_micro_kernel<1>(A + row * input_channels, input_channels, panel, input_channels,
+                                  C + row * output_channels + first_col, output_channels, columns, scales,
+                                  panel_bias);
+        }
+    }
+}
+}  // namespace
+
+void VPUNN::Dense(const VPUNN::PackedDenseWeights& weights, const VPUNN::Tensor<float>* activations,
+                  VPUNN::Tensor<float>* output, const VPUNN::Tensor<float>* bias) {
+    const int batch_size = activations->shape()[0];
+    const float* A{activations->c_ptr()};
+    float* C{output->data()};
+    const float* bias_data{bias ? bias->c_ptr() : nullptr};
+
+    switch (weights.precision()) {
+    case WeightsPrecision::BF16:
+        dense_packed<std::uint16_t>(
+                weights,
+                [&weights](int p) {
+                    return weights.panel_bf16(p);
+                },
+                A, batch_size, C, bias_data);
+        break;
+    case WeightsPrecision::INT8:
+        dense_packed<std::int8_t>(
+                weights,
+                [&weights](int p) {
+                    return weights.panel_int8(p);
+                },
+                A, batch_size, C, bias_data);
+        break;
+    default:
+        dense_packed<float>(
+                weights,
+                [&weights](int p) {
+                    return weights.panel(p);
+                },
+                A, batch_size, C, bias_data);
+        break;
+    }
+}
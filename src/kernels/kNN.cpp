@@ -8,71 +8,87 @@
 // Software Package for additional details.
 
 #include "kernels/kNN.h"
-#include <queue>
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include "kernels/vpunn_blas.h"
 
-// Find the smallest N items in an array
-void n_index(int n_index, float* data, unsigned int* index, unsigned int size) {
-    std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>,
-                        std::greater<std::pair<float, unsigned int>>>
-            q;
-    for (unsigned int i = 0; i < size; ++i) {
-        q.push(std::pair<float, unsigned int>(data[i], i));
-    }
-    for (int i = 0; i < n_index; ++i) {
-        int ki = q.top().second;
-        index[i] = ki;
-        q.pop();
-    }
+// Find the indexes of the smallest n_index items of one row, in increasing order of (distance, index)
+// Partial selection, O(size * log(n_index)), no per item heap allocation
+void n_index(unsigned int n_index, const float* data, unsigned int* index, unsigned int size,
+             std::vector<unsigned int>& candidates) {
+    candidates.resize(size);
+    std::iota(candidates.begin(), candidates.end(), 0U);
+
+    const auto closer = [data](const unsigned int a, const unsigned int b) {
+        return (data[a] < data[b]) || (!(data[b] < data[a]) && (a < b));  // ties are ordered by index
+    };
+    std::partial_sort(candidates.begin(), candidates.begin() + n_index, candidates.end(), closer);
+    std::copy_n(candidates.cbegin(), n_index, index);
 }
 
-void neighbours_idx(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float>* activations, int n_neighbours,
-                    VPUNN::Tensor<unsigned int>& indexes, VPUNN::Tensor<float>& distances) {
+void neighbours_idx(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float>* activations,
+                    unsigned int n_neighbours, VPUNN::Tensor<unsigned int>& indexes, VPUNN::Tensor<float>& distances) {
     // activations is of the shape [Batch, embedding]
     // weights is of the shape [items, embedding]
-    unsigned int embedding_shape = weights->shape()[1];
-    unsigned int batch_size = activations->shape()[0];
-    unsigned int items = weights->shape()[0];
+    const unsigned int embedding_shape = weights->shape()[1];
+    const unsigned int batch_size = activations->shape()[0];
+    const unsigned int items = weights->shape()[0];
 
-    // compute the matmul between activations and weights: 1 - A * W.T
+    // compute the matmul between activations and weights: A * W.T
     // A is of shape [batch, embeddings] => shape: m, k
     // W.t is of shape [embeddings, items] => shape: k, n
-    // output is of shape [batch, items] => shape: m, n
+    // output is of shape [batch, items] => shape: m, n, row major
     // m = batch, k = embeddings, n = items
-    cblas_sgemm(CblasColMajor, CblasNoTrans, CblasTrans, batch_size, items, embedding_shape, -1.0, activations->c_ptr(),
-                batch_size, weights->c_ptr(), items, 1.0, distances.data(), batch_size);
+    // Row major, B transposed, alpha=1, beta=0 is the optimized (SIMD dot product) GEMM path
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, batch_size, items, embedding_shape, 1.0F,
+                activations->c_ptr(), embedding_shape, weights->c_ptr(), embedding_shape, 0.0F, distances.data(),
+                items);
+
+    // distance = 1 - A * W.T
+    float* const dist = distances.data();
+    const auto all_distances{static_cast<std::size_t>(batch_size) * items};
+    for (std::size_t i = 0; i < all_distances; ++i) {
+        dist[i] = 1.0F - dist[i];
+    }
 
-    // This piece of code is hideous, I think it can be parallelized at least for batch exploration
+    // each batch row is independent, the selection buffer is reused between rows
+    std::vector<unsigned int> candidates;
     for (unsigned int b_idx = 0; b_idx < batch_size; b_idx++) {
-        n_index(n_neighbours, &(distances[b_idx * items]), indexes.data() + b_idx * n_neighbours, items);
+        n_index(n_neighbours, dist + static_cast<std::size_t>(b_idx) * items,
+                indexes.data() + static_cast<std::size_t>(b_idx) * n_neighbours, items, candidates);
     }
 }
 
 void VPUNN::kNN(const VPUNN::Tensor<float>* weights, const VPUNN::Tensor<float>* targets,
                 const VPUNN::Tensor<float>* activations, VPUNN::Tensor<float>* output, unsigned int n_neighbours) {
-    if (n_neighbours < 1) {
+    const unsigned int batch_size = activations->shape()[0];
+    const unsigned int items = weights->shape()[0];
+
+    // cannot have more neighbours than items
+    n_neighbours = std::min(n_neighbours, items);
+    if (n_neighbours < 1 || batch_size < 1) {
         // precondition not met!
         return;
     }
 
-    const unsigned int batch_size = activations->shape()[0];
-    const unsigned int items = weights->shape()[0];
-
     // Tensor containing all the index of
     auto indexes = VPUNN::Tensor<unsigned int>({batch_size, n_neighbours});
-    // Initialize the distance vector to be all 1's
-    auto distances = VPUNN::Tensor<float>({batch_size, items}, 1.0);
+    // distances between each batch row and each item, row major [batch, items]
+    auto distances = VPUNN::Tensor<float>({batch_size, items});
     neighbours_idx(weights, activations, n_neighbours, indexes, distances);
 
     // Compute the weighted average of the distances
+    const unsigned int output_size = static_cast<unsigned int>(output->size()) / batch_size;
     for (unsigned int b_idx = 0; b_idx < batch_size; b_idx++) {
+        const float* const row_distances = distances.c_ptr() + static_cast<std::size_t>(b_idx) * items;
+        const unsigned int* const row_indexes = indexes.c_ptr() + static_cast<std::size_t>(b_idx) * n_neighbours;
         float sum = 0, prediction = 0;
         for (unsigned int idx = 0; idx < n_neighbours; idx++) {
-            const float weight = 1.0f / (distances[indexes[idx]] + 1e-12f);
-            prediction += targets->c_ptr()[indexes[idx]] * weight;
+            const float weight = 1.0f / (row_distances[row_indexes[idx]] + 1e-12f);
+            prediction += targets->c_ptr()[row_indexes[idx]] * weight;
             sum += weight;
         }
-        output->data()[b_idx * n_neighbours] = prediction / sum;
+        output->data()[b_idx * output_size] = prediction / sum;
     }
 }
@@ -141,7 +141,7 @@ std::list<DPUWorkloadsWithCyclesSplit> ITilerAlgorithm::split_tile_in_workloads(
     std::list<DPUWorkloadsWithCyclesSplit> splitPool;
     // Optimized for 1 workloads  (todo Analyse if necessary,  what if it is not valid?)
     if (nWorkloads == 1) {
-        DPUWorkloadsWithCyclesSplit workloads_split{{Cycles::NO_ERROR}, {layer_on_tile}};  // same as original
+        DPUWorkloadsWithCyclesSplit workloads_split{{Cycles::NO_ERROR}, {layer_on_tile}, {}};  // same as original
         ITilerAlgorithm::setWorkloadsModeAndInfereInputShape(workloads_split, mode,
                                                              layer_on_tile);  // computes also input tensor
         splitPool.push_back(std::move(workloads_split));
@@ -7,12 +7,17 @@
 // Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
 // Software Package for additional details.
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <numeric>
 
 #include "core/profiling.h"
+#include "vpu/optimization/split_pool.h"
 #include "vpu/optimization/tiler.h"
 #include "vpu/optimization/workload_optimization.h"
 #include "vpu/device_layer_properties/device_layer_properties_holder.h"
+#include "vpu/dpu_theoretical_cost_provider.h"
 
 namespace VPUNN {
 
@@ -28,36 +33,59 @@ inline bool operator<(const DPUWorkloadsWithCyclesSplit& lhs, const DPUWorkloads
 class DPUTilerImplementation : public IDPUTiler {
 private:
     VPUCostModel& model;  /// < The DPU cost model used for performance estimation
+    const DPUTheoreticalCostProvider theoretical{model.getPerformanceModel()};  ///< for the lower bound of splits
     const HWPerformanceModel& get_HWPerformance() const {
         return model.getPerformanceModel();
     }
 
-    VPUDevice getWorkloadsDevice(const DPUWorkloadsWithCyclesSplit& workloads) const {
-        if (workloads.workloads.size() == 0) {
+    /// @brief the device of a list of workloads, all must be on the same device
+    VPUDevice getWorkloadsDevice(const DPUWorkload* workloads, const std::size_t count) const {
+        if (count == 0) {
             throw_error<std::invalid_argument>("getWorkloadsDevice:empty workloads list");
         }
-        VPUDevice device = workloads.workloads[0].device;
-        for (unsigned int idx = 1; idx < workloads.workloads.size(); idx++) {
-            if (workloads.workloads[idx].device != device) {
+        VPUDevice device = workloads[0].device;
+        for (std::size_t idx = 1; idx < count; idx++) {
+            if (workloads[idx].device != device) {
                 throw_error<std::invalid_argument>("getWorkloadsDevice: more than one device for a workloads list");
             }
         }
         return device;
     }
 
-    std::list<DPUWorkloadsWithCycleCost> generateSplits(const TilingAlgorithmsContainer& algorithms,
-                                                        const std::vector<ExecutionMode>& valid_execution_modes,
-                                                        const SplitOptions& options) const {
-        std::list<DPUWorkloadsWithCycleCost> splits_costs;
-        // Loop algorithms, splits, modes and populate the DPUWorkloadsCost list
+    /// @brief true if the optimization target needs the energy of the splits
+    static bool isEnergyTarget(const VPUOptimizationTarget target) {
+        return (target == VPUOptimizationTarget::POWER) || (target == VPUOptimizationTarget::EDP);
+    }
+
+    /// @brief true if a split can be selected: it was costed with no error and non zero cycles
+    static bool isValidSplit(const SplitPool::Split& split) {
+        return split.costed && !Cycles::isErrorCode(split.cost) && split.cost > 0;
+    }
+
+    /// @brief all splits of a layer, in the pool, with their cost. Energy is computed for each workload if with_energy
+    /// is true
+    void generateSplits(const DPULayer& layer, const SplitOptions& options, const bool with_energy,
+                        SplitPool& pool) const {
+        // Get execution modes accepted  (e.g.: ExecutionMode::CUBOID_16x16,.....)
+        auto valid_execution_modes =
+                LayerPropertiesHolder::get_properties(layer.device).getValidTilingExecutionMode(layer);  // based on operation
+
+        // get all in-tile tiling algorithms. Each algo has a copy of Layer.
+        TilingAlgorithmsContainer algorithms{getTilingAlgorithms(layer, options)};
+
+        // Compute the cost of each split type.
+        // compute splits(one is a vector of DPUWorkload)  and cost for each split.
+        generateSplits(algorithms, valid_execution_modes, options, with_energy, pool);
+    }
+
+    void generateSplits(const TilingAlgorithmsContainer& algorithms,
+                        const std::vector<ExecutionMode>& valid_execution_modes, const SplitOptions& options,
+                        const bool with_energy, SplitPool& pool) const {
+        // Loop algorithms, splits, modes and populate the pool
         auto timeout = SyncStopWatch<std::micro>();
         if (options.maxLatencyUs > 0)
             timeout.start();
 
-        if (options.target == VPUOptimizationTarget::POWER) {
-            throw_error<std::runtime_error>("generateSplits: not Handling VPUOptimizationTarget::POWER");
-        }
-
         for (auto& algo : algorithms) {
             for (auto& mode : valid_execution_modes) {
                 // in how many pieces to be tried to be split
@@ -65,53 +93,185 @@ private:
                 for (auto nWorkloads : split_count_variants) {
                     // Return if the max time has elapsed
                     if (options.maxLatencyUs > 0 && timeout.interval() > options.maxLatencyUs) {
-                        return splits_costs;
+                        return;
                     }
 
                     // populates splitVariants with 0, 1 or more workloads vectors
                     std::list<DPUWorkloadsWithCyclesSplit> splitVariants{
                             algo->split_tile_in_workloads(mode, nWorkloads)};
                     for (auto& workloads : splitVariants) {
-                        // measure  this variant. try catch , and check its output for errors
-                        try {
-                            const auto pnp = getLayerPerformance(workloads, options.runtimeOverhead);  // may throw
-
-                            const CyclesInterfaceType wl_cost{
-                                    pnp.cycles <= 0 ? Cycles::ERROR_TILE_SPLIT_ZERO_CYC_OUTPUT  // no zero allowed
-                                                    : pnp.cycles};
-
-                            if (Cycles::isErrorCode(wl_cost)) {
-                                Logger::warning() << "\n Error result (or zero cycles) while computing the performance "
-                                                  << "of workloads split variants! "
-                                                  << "ERROR code: " << wl_cost << " : " << Cycles::toErrorText(wl_cost)
-                                                  << "\n Execution mode: " << (int)mode << " : "
-                                                  << ExecutionMode_ToText.at(static_cast<int>(mode))
-                                                  << "\n nWorkloads: " << nWorkloads << "\n Algo : " << algo->name()
-                                                  << " \n Result: ignoring the cost of this workloads split \n";
-                            }
-
-                            // good or bad we keep the result
-                            splits_costs.push_back({wl_cost, workloads});
-
-                        } catch (const std::exception& e) {
-                            Logger::warning() << "\n Exception thrown while computing the performance of workloads "
-                                              << "split variants! "
-                                              << "\n Execution mode: " << (int)mode << " : "
-                                              << ExecutionMode_ToText.at(static_cast<int>(mode))
-                                              << "\n nWorkloads: " << nWorkloads << "\n Algo : " << algo->name()
-                                              << "\n Exception: " << e.what() << "\n "
-                                              << "\nResult: ignoring the cost of this workloads split \n";
-
-                            // add the error result
-                            splits_costs.push_back(
-                                    {(CyclesInterfaceType)Cycles::ERROR_TILE_SPLIT_EXCEPTION, workloads});
-                        }
-
+                        // good or bad we keep the result
+                        const auto idx{pool.add(std::move(workloads))};
+                        costSplit(pool, idx, options, with_energy, *algo, mode, nWorkloads);
                     }  // cost of workloads
                 }
             }
         }
-        return splits_costs;
+    }
+
+    /// @brief origin of a split, for logging
+    struct SplitOrigin {
+        const ITilerAlgorithm* algo;  ///< the algorithm that generated the split
+        ExecutionMode mode;           ///< execution mode of the split
+        unsigned int nWorkloads;      ///< requested number of workloads
+    };
+
+    /// @brief like generateSplits but costs the splits in increasing order of their lower bound and stops when the
+    /// bound exceeds the best cost found. Splits that are not costed stay in the pool marked as such.
+    void generateSplitsPruned(const DPULayer& layer, const SplitOptions& options, SplitSearchStats& stats,
+                              SplitPool& pool) const {
+        auto valid_execution_modes =
+                LayerPropertiesHolder::get_properties(layer.device).getValidTilingExecutionMode(layer);
+        TilingAlgorithmsContainer algorithms{getTilingAlgorithms(layer, options)};
+
+        auto timeout = SyncStopWatch<std::micro>();
+        if (options.maxLatencyUs > 0)
+            timeout.start();
+
+        // all candidates with their bound, no inference is done
+        std::pmr::vector<SplitOrigin> origins{pool.resource()};
+        std::pmr::vector<CyclesInterfaceType> bounds{pool.resource()};
+        for (auto& algo : algorithms) {
+            for (auto& mode : valid_execution_modes) {
+                const auto split_count_variants = algo->generateSplitPool(options.nDPU, mode);
+                for (auto nWorkloads : split_count_variants) {
+                    std::list<DPUWorkloadsWithCyclesSplit> splitVariants{
+                            algo->split_tile_in_workloads(mode, nWorkloads)};
+                    for (auto& workloads : splitVariants) {
+                        const auto idx{pool.add(std::move(workloads))};
+                        bounds.push_back(splitLowerBound(pool.workloads_of(idx), pool[idx].count,
+                                                         options.runtimeOverhead));
+                        origins.push_back({algo.get(), mode, nWorkloads});
+                    }
+                }
+            }
+        }
+        stats.candidates = static_cast<unsigned int>(pool.size());
+
+        std::pmr::vector<std::size_t> order{pool.resource()};
+        order.resize(pool.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&bounds](const std::size_t a, const std::size_t b) {
+            return bounds[a] < bounds[b];
+        });
+
+        CyclesInterfaceType best{Cycles::NO_ERROR};
+        bool has_best{false};
+        for (const auto idx : order) {
+            if (has_best && bounds[idx] > best) {
+                // bounds are increasing, none of the remaining can be better than best
+                stats.pruned = stats.candidates - stats.costed;
+                break;
+            }
+            if (options.maxLatencyUs > 0 && timeout.interval() > options.maxLatencyUs) {
+                break;
+            }
+
+            const auto& origin{origins[idx]};
+            costSplit(pool, idx, options, false, *origin.algo, origin.mode, origin.nWorkloads);
+            ++stats.costed;
+            if (isValidSplit(pool[idx]) && (!has_best || pool[idx].cost < best)) {
+                best = pool[idx].cost;
+                has_best = true;
+            }
+        }
+    }
+
+    /// @brief lower bound of the cycles of a split, no inference is done.
+    /// Each workload lasts at least its ideal cycles (100% MAC utilization, sparsity considered) or its theoretical
+    /// cycles (the fallback cost when no NN is available), whichever is smaller. Any schedule on nDPU lasts at least as
+    /// the longest workload and at least as the total work divided evenly on the DPUs.
+    CyclesInterfaceType splitLowerBound(const DPUWorkload* workloads, const std::size_t count,
+                                        const unsigned int runtimeOverhead) const {
+        if (count == 0) {
+            return 0;
+        }
+        try {
+            const auto& hw_model{get_HWPerformance()};
+            const unsigned long int nDPU{hw_model.get_hw_info(getWorkloadsDevice(workloads, count)).nDPU_per_tile()};
+            unsigned long int longest{0};
+            unsigned long int total{0};
+            for (std::size_t idx = 0; idx < count; idx++) {
+                const auto& wl{workloads[idx]};
+                const unsigned long int ideal{std::min({hw_model.DPU_Power_IdealCycles(wl),
+                                                        hw_model.DPU_Efficency_IdealCycles(wl),
+                                                        theoretical.DPUTheoreticalCycles(wl)}) +
+                                              runtimeOverhead};
+                longest = std::max(longest, ideal);
+                total += ideal;
+            }
+            const unsigned long int bound{std::max(longest, ceil_division(total, std::max(nDPU, 1UL)))};
+            constexpr unsigned long int max_valid{Cycles::START_ERROR_RANGE};  // cannot be larger than a valid cost
+            return static_cast<CyclesInterfaceType>(std::min(bound, max_valid));
+        } catch (const std::exception&) {
+            return 0;  // no bound known, will be costed
+        }
+    }
+
+    /// @brief costs one split of the pool, errors (or zero cycles) are logged and stored as error codes
+    void costSplit(SplitPool& pool, const std::size_t idx, const SplitOptions& options, const bool with_energy,
+                   const ITilerAlgorithm& algo, const ExecutionMode mode, const unsigned int nWorkloads) const {
+        auto& split{pool[idx]};
+        split.costed = true;
+        // measure  this variant. try catch , and check its output for errors
+        try {
+            const auto pnp = rangePerformance(pool.workloads_of(idx), split.count, pool.cycles_of(idx),
+                                              with_energy ? pool.energy_of(idx) : nullptr,
+                                              options.runtimeOverhead);  // may throw
+
+            const CyclesInterfaceType wl_cost{pnp.cycles <= 0 ? Cycles::ERROR_TILE_SPLIT_ZERO_CYC_OUTPUT  // no zero
+                                                              : pnp.cycles};
+
+            if (Cycles::isErrorCode(wl_cost)) {
+                Logger::warning() << "\n Error result (or zero cycles) while computing the performance "
+                                  << "of workloads split variants! "
+                                  << "ERROR code: " << wl_cost << " : " << Cycles::toErrorText(wl_cost)
+                                  << "\n Execution mode: " << (int)mode << " : "
+                                  << ExecutionMode_ToText.at(static_cast<int>(mode)) << "\n nWorkloads: " << nWorkloads
+                                  << "\n Algo : " << algo.name()
+                                  << " \n Result: ignoring the cost of this workloads split \n";
+            }
+            split.cost = wl_cost;
+            split.energy = pnp.energy;
+
+        } catch (const std::exception& e) {
+            Logger::warning() << "\n Exception thrown while computing the performance of workloads "
+                              << "split variants! "
+                              << "\n Execution mode: " << (int)mode << " : "
+                              << ExecutionMode_ToText.at(static_cast<int>(mode)) << "\n nWorkloads: " << nWorkloads
+                              << "\n Algo : " << algo.name() << "\n Exception: " << e.what() << "\n "
+                              << "\nResult: ignoring the cost of this workloads split \n";
+
+            // the error result
+            split.cost = (CyclesInterfaceType)Cycles::ERROR_TILE_SPLIT_EXCEPTION;
+        }
+    }
+
+    /// @brief copies the costed splits of the pool requested by options.detailLevel to the output list of
+    /// investigated splits
+    /// @param ranked the best costed splits, best first. At least the winner
+    static void exportSplits(const SplitPool& pool, const SplitOptions& options, const bool with_energy,
+                             const std::pmr::vector<std::size_t>& ranked,
+                             std::vector<DPUWorkloadsWithCyclesSplit>& output) {
+        switch (options.detailLevel) {
+        case SplitDetailLevel::NONE:
+            break;
+        case SplitDetailLevel::WINNER_ONLY:
+        case SplitDetailLevel::TOP_K: {
+            const std::size_t wanted{options.detailLevel == SplitDetailLevel::TOP_K ? options.detailTopK : 1U};
+            for (std::size_t rank = 0; rank < std::min(wanted, ranked.size()); rank++) {
+                output.push_back(pool.materialize_split(ranked[rank], with_energy));
+            }
+        } break;
+        case SplitDetailLevel::ALL:
+        default:
+            for (std::size_t idx = 0; idx < pool.size(); idx++) {
+                if (pool[idx].costed) {
+                    output.push_back(pool.materialize_split(idx, with_energy));
+                }
+            }
+            break;
+        }
     }
 
 public:
@@ -123,129 +283,254 @@ public:
     explicit DPUTilerImplementation(VPUCostModel& _model): model{_model} {
     }
 
-    DPUWorkloadsCost intraTileSplit(
-            const DPULayer& layer, const SplitOptions& options,
-            std::vector<DPUWorkloadsWithCyclesSplit>* complete_output_splits = nullptr) const override {
-        // Get execution modes accepted  (e.g.: ExecutionMode::CUBOID_16x16,.....)
-        auto valid_execution_modes =
-                LayerPropertiesHolder::get_properties(layer.device).getValidTilingExecutionMode(layer);  // based on operation
-
-        // get all in-tile tiling algorithms. Each algo has a copy of Layer.
-        TilingAlgorithmsContainer algorithms{getTilingAlgorithms(layer, options)};
-
-        // Compute the cost of each split type.
-        // compute splits(one is a vector of DPUWorkload)  and cost for each split.
-        std::list<DPUWorkloadsWithCycleCost> splits_costs{generateSplits(algorithms, valid_execution_modes, options)};
-
-        if (splits_costs.size() == 0) {  // nothing to return
-            throw_error<std::runtime_error>("intraTileSplit: no valid workload generated");
+    DPUWorkloadsCost intraTileSplit(const DPULayer& layer, const SplitOptions& options,
+                                    std::vector<DPUWorkloadsWithCyclesSplit>* complete_output_splits = nullptr,
+                                    SplitSearchStats* stats = nullptr) const override {
+        // the bound is on cycles, energy targets are always fully searched
+        const bool pruned_search{options.pruneSplits && !isEnergyTarget(options.target)};
+        const bool with_energy{isEnergyTarget(options.target)};
+
+        SplitPool pool;
+        SplitSearchStats search_stats{};
+        if (pruned_search) {
+            generateSplitsPruned(layer, options, search_stats, pool);
+        } else {
+            generateSplits(layer, options, with_energy, pool);
+            search_stats.candidates = static_cast<unsigned int>(pool.size());
+            search_stats.costed = search_stats.candidates;
+        }
+        if (stats != nullptr) {
+            *stats = search_stats;
         }
 
-        if (complete_output_splits != nullptr) {
-            for (const auto& split : splits_costs) {
-                complete_output_splits->push_back(split.second);  // second is the DPUWorkloads
-            }
+        if (pool.empty()) {  // nothing to return
+            throw_error<std::runtime_error>("intraTileSplit: no valid workload generated");
         }
 
-        // lambda comparator for obtaining the minimum one that has no errors and is not zero!
-        auto comp = [](const DPUWorkloadsWithCycleCost& a, const DPUWorkloadsWithCycleCost& b) {
+        // comparator for obtaining the minimum one that has no errors and is not zero!
+        auto is_better = [target = options.target](const SplitPool::Split& a, const SplitPool::Split& b) {
             // zero is not a min candidate
             // error is not a min candidate
-            // .first is the  cycle time of the workloads split
-            if (Cycles::isErrorCode(a.first) || a.first <= 0) {
+            if (!isValidSplit(a)) {
                 return false;  // a not < b, b might be good or not. If both bad they are equal
             }
             // a is valid here
-            if (Cycles::isErrorCode(b.first) || b.first <= 0) {
+            if (!isValidSplit(b)) {
                 return true;  // keep a<b if b is invalid value, and "a" valid
             }
             // both valid
-            return (a.first) < (b.first);
+            if (target == VPUOptimizationTarget::POWER) {
+                if (a.energy != b.energy) {
+                    return a.energy < b.energy;
+                }
+            } else if (target == VPUOptimizationTarget::EDP) {
+                const double a_edp{static_cast<double>(a.energy) * a.cost};
+                const double b_edp{static_cast<double>(b.energy) * b.cost};
+                if (a_edp != b_edp) {
+                    return a_edp < b_edp;
+                }
+            }
+            return (a.cost) < (b.cost);  // LATENCY, or tie break
         };
 
         // Return the split with min cost (the optimal one). or the first error code (or zero)
-        // iterator to min
-        const auto& minimum_split{std::min_element(splits_costs.begin(), splits_costs.end(), comp)};
+        // in enumeration order, only costed splits are candidates
+        std::size_t minimum{pool.size()};
+        for (std::size_t idx = 0; idx < pool.size(); idx++) {
+            if (pool[idx].costed && (minimum == pool.size() || is_better(pool[idx], pool[minimum]))) {
+                minimum = idx;
+            }
+        }
+
+        if (complete_output_splits != nullptr && options.detailLevel != SplitDetailLevel::NONE) {
+            std::pmr::vector<std::size_t> ranked{pool.resource()};  // only the winner, unless more are requested
+            if (options.detailLevel == SplitDetailLevel::TOP_K) {
+                for (std::size_t idx = 0; idx < pool.size(); idx++) {
+                    if (pool[idx].costed) {
+                        ranked.push_back(idx);
+                    }
+                }
+                std::stable_sort(ranked.begin(), ranked.end(), [&](const std::size_t a, const std::size_t b) {
+                    return is_better(pool[a], pool[b]);
+                });
+            } else {
+                ranked.push_back(minimum);
+            }
+            exportSplits(pool, options, with_energy, ranked, *complete_output_splits);
+        }
+
+        return {pool[minimum].cost, pool.materialize(minimum)};  // DPUWorkloadsCost pair, only winner is copied
+    }
 
-        return {minimum_split->first, minimum_split->second.workloads};  // DPUWorkloadsCost pair
+    std::vector<DPUWorkloadsPnP> intraTileParetoFront(const DPULayer& layer,
+                                                      const SplitOptions& options) const override {
+        SplitPool pool;
+        generateSplits(layer, options, true, pool);
+
+        std::pmr::vector<std::size_t> candidates{pool.resource()};
+        candidates.reserve(pool.size());
+        for (std::size_t idx = 0; idx < pool.size(); idx++) {
+            if (isValidSplit(pool[idx])) {  // errors and zero are not candidates
+                candidates.push_back(idx);
+            }
+        }
+
+        // by cycles, then by energy, then prefer less workloads
+        std::stable_sort(candidates.begin(), candidates.end(), [&pool](const std::size_t ia, const std::size_t ib) {
+            const auto& a{pool[ia]};
+            const auto& b{pool[ib]};
+            if (a.cost != b.cost) {
+                return a.cost < b.cost;
+            }
+            if (a.energy != b.energy) {
+                return a.energy < b.energy;
+            }
+            return a.count < b.count;
+        });
+
+        // a candidate is on the front only if it spends less energy than all the faster ones
+        std::vector<DPUWorkloadsPnP> front;
+        for (const auto idx : candidates) {
+            if (front.empty() || pool[idx].energy < front.back().energy) {
+                front.push_back({pool[idx].cost, pool[idx].energy, pool.materialize(idx)});
+            }
+        }
+        return front;
     }
 
     PnPEstimates getLayerPerformance(DPUWorkloadsWithCyclesSplit& workloads_split,
                                      const unsigned int runtimeOverhead = 0,
                                      const bool skip_power = true) const override {
+        const auto count{workloads_split.workloads.size()};
+        workloads_split.cycles.resize(count);
+        if (!skip_power) {
+            workloads_split.energy.resize(count);
+        }
+        return rangePerformance(workloads_split.workloads.data(), count, workloads_split.cycles.data(),
+                                skip_power ? nullptr : workloads_split.energy.data(), runtimeOverhead);
+    }
+
+private:
+    /// @brief cycles and power estimate for a range of workloads, see getLayerPerformance
+    ///
+    /// @param workloads first workload
+    /// @param count number of workloads
+    /// @param cycles [out] cycles of each workload, count elements
+    /// @param energy [out] energy of each workload, count elements. nullptr if energy is not needed
+    /// @param runtimeOverhead execution runtime overhead in cycles (per workload)
+    PnPEstimates rangePerformance(const DPUWorkload* workloads, const std::size_t count, CyclesInterfaceType* cycles,
+                                  float* energy, const unsigned int runtimeOverhead) const {
         // For an empty list of workloads immediately return 0
-        if (workloads_split.workloads.size() == 0)
-            return {0, 0.0f};  // no runtime to execute nothing
+        if (count == 0)
+            return {0, 0.0f, 0.0f};  // no runtime to execute nothing
 
-        // std::vector<CyclesInterfaceType> workload_cycles;
-        // workload_cycles.reserve(workloads.size());
-        //  Iterate over the workloads and compute the execution time in cycles
-        //  The result is stored in the workload_cycles vector
+        // Splits have usually many workloads that differ only by offsets (position in the tile), these have the same
+        // cost. Only one workload of each shape class is costed, its cycles are used for all the class
         //  In practice, it was observed that caching DPU calls has lower runtime than doing batched DPU calls.
+        std::vector<unsigned int> class_of;
+        const std::vector<unsigned int> representatives{shapeClasses(workloads, count, class_of)};
+
+        std::vector<CyclesInterfaceType> class_cycles(representatives.size());
         std::string info;
-        for (size_t idx = 0; idx < workloads_split.workloads.size(); idx++) {
-            workloads_split.cycles[idx] = model.DPU(workloads_split.workloads[idx], info);
+        for (size_t c = 0; c < representatives.size(); c++) {
+            class_cycles[c] = model.DPU(workloads[representatives[c]], info);
+        }
+        for (size_t idx = 0; idx < count; idx++) {
+            cycles[idx] = class_cycles[class_of[idx]];
         }
 
-        const auto how_many_errors{countErrors(workloads_split.cycles)};
+        const auto how_many_errors{countErrors(cycles, count)};
 
         if (how_many_errors > 0) {  // errors
-            const auto errIndex =
-                    (firstErrorIndex(workloads_split.cycles) >= 0) ? firstErrorIndex(workloads_split.cycles) : 0;
+            const auto errIndex = (firstErrorIndex(cycles, count) >= 0) ? firstErrorIndex(cycles, count) : 0;
             Logger::warning() << "\n Error result returned by DPU for workloads"
-                              << "\n Errors cnt: " << how_many_errors
-                              << " , from a wl_list size: " << workloads_split.cycles.size()
-                              << "\nFirst ERROR code: " << workloads_split.cycles[errIndex] << " : "
-                              << Cycles::toErrorText(workloads_split.cycles[errIndex])
-                              << "\n runtimeOverhead: " << runtimeOverhead
-                              << "\n Workload of first error: " << workloads_split.workloads[errIndex]
+                              << "\n Errors cnt: " << how_many_errors << " , from a wl_list size: " << count
+                              << "\nFirst ERROR code: " << cycles[errIndex] << " : "
+                              << Cycles::toErrorText(cycles[errIndex]) << "\n runtimeOverhead: " << runtimeOverhead
+                              << "\n Workload of first error: " << workloads[errIndex]
                               << "\n Returning first error for entire workloads";
 
-            return {workloads_split.cycles[errIndex], 0.0f};  // return first error code
+            return {cycles[errIndex], 0.0f, 0.0f};  // return first error code
         }
 
         // Compute the total execution cycles, on good values (no overflow protection)
-        auto total_cycles = dpu_schedule<CyclesInterfaceType>(
-                get_HWPerformance().get_hw_info(getWorkloadsDevice(workloads_split)).nDPU_per_tile(),
+        auto total_cycles = dpu_schedule(
+                get_HWPerformance().get_hw_info(getWorkloadsDevice(workloads, count)).nDPU_per_tile(),
                 // GlobalHarwdwareCharacteristics::nDPU_per_tile(getWorkloadsDevice(workloads_split)),
-                workloads_split.cycles, runtimeOverhead);
+                cycles, cycles + count, runtimeOverhead);
 
-        // Get the average power by computing the workload on ratio by dividing its cycles by the total layer cycles
+        // Get the average power by dividing the energy of all workloads by the total layer cycles
+        float total_energy = 0.0f;
         float average_power = 0.0f;
-        if (!skip_power) {
-            /*unsigned int idx = 0;
-            for (DPUWorkload wl : workloads) {
-                float workload_on_ratio = total_cycles > 0 ? (float)workload_cycles[idx++] / total_cycles : 0.0f;
-                average_power += 0 * workload_on_ratio;
-            }*/
-            average_power = 0.0f;
+        if (energy != nullptr) {
+            DPUWorkloads class_workloads;
+            class_workloads.reserve(representatives.size());
+            for (const auto r : representatives) {
+                class_workloads.push_back(workloads[r]);
+            }
+            const auto class_energy{model.DPUEnergy(class_workloads)};  // one batch for all classes
+            for (size_t idx = 0; idx < count; idx++) {
+                energy[idx] = class_energy[class_of[idx]];
+            }
+            total_energy = std::accumulate(energy, energy + count, 0.0f);
+            average_power = total_cycles > 0 ? total_energy / static_cast<float>(total_cycles) : 0.0f;
         }
 
-        // Return a PnP structure with total cycles and average power
-        return {total_cycles, average_power};
+        // Return a PnP structure with total cycles, average power and energy
+        return {total_cycles, average_power, total_energy};
+    }
+
+    /// @brief groups the workloads in classes that have the same cost: all fields that are relevant for costing are
+    /// equal, they may differ only by offsets and layer_info
+    ///
+    /// @param workloads the workloads to be classified
+    /// @param count number of workloads
+    /// @param class_of [out] the class index of each workload
+    /// @returns the index of the first workload of each class (the one to be costed), in order of appearance
+    static std::vector<unsigned int> shapeClasses(const DPUWorkload* workloads, const std::size_t count,
+                                                  std::vector<unsigned int>& class_of) {
+        // DPUWorkload::operator< ignores offsets and layer_info (like the cache key), the cost source hint is not
+        // ignored since it selects the cost provider
+        const auto less = [](const DPUWorkload* a, const DPUWorkload* b) {
+            if (*a < *b || *b < *a) {
+                return *a < *b;
+            }
+            return a->cost_source_hint < b->cost_source_hint;
+        };
+        std::map<const DPUWorkload*, unsigned int, decltype(less)> classes{less};
+
+        std::vector<unsigned int> representatives;
+        class_of.resize(count);
+        for (unsigned int idx = 0; idx < count; idx++) {
+            const auto [it, is_new] =
+                    classes.emplace(&workloads[idx], static_cast<unsigned int>(representatives.size()));
+            if (is_new) {
+                representatives.push_back(idx);
+            }
+            class_of[idx] = it->second;
+        }
+        return representatives;
     }
 
-private:
     /// @brief Checks a list of cycle times for errors. counts the errors
     ///
     /// @param workloads_cycles the cycles list
+    /// @param count number of cycles in the list
     /// @returns how many errors are present  (zero cycles is not error)
-    int countErrors(const std::vector<CyclesInterfaceType>& workloads_cycles) const {
+    int countErrors(const CyclesInterfaceType* workloads_cycles, const std::size_t count) const {
         int counter{0};
-        for (const auto t : workloads_cycles) {
-            if (Cycles::isErrorCode(t)) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (Cycles::isErrorCode(workloads_cycles[i])) {
                 ++counter;
             }
         }
         return counter;
     }
 
-    int firstErrorIndex(const std::vector<CyclesInterfaceType>& workloads_cycles) const {
-        if (countErrors(workloads_cycles) > 0) {
-            for (decltype(workloads_cycles.size()) i = 0; i < workloads_cycles.size(); ++i) {
-                if (Cycles::isErrorCode(workloads_cycles[i])) {
-                    return static_cast<int>(i);
-                }
+    int firstErrorIndex(const CyclesInterfaceType* workloads_cycles, const std::size_t count) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (Cycles::isErrorCode(workloads_cycles[i])) {
+                return static_cast<int>(i);
             }
         }
         return -1;
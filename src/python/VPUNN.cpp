@@ -6,13 +6,362 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <core/executor.h>
 #include <vpu_cost_model.h>
 #include <vpu_dma_cost_model.h>
+#include <vpu_layer_cost_model.h>
+#include <vpu_network_cost_model.h>
 #include <vpu/types.h>
 #include <vpu/dma_types.h>
+#include <vpu/shave_workload.h>
 
 namespace py = pybind11;
 
+namespace {
+
+/// a numeric column of a workloads table, read without the GIL. Absent optional columns have no data
+template <typename T>
+class Column {
+public:
+    Column() = default;
+    explicit Column(py::array_t<T, py::array::c_style | py::array::forcecast> array)
+            : array{std::move(array)}, values{this->array.data()} {
+    }
+
+    bool present() const {
+        return values != nullptr;
+    }
+    T operator[](const std::size_t row) const {
+        return values[row];
+    }
+
+private:
+    py::array_t<T, py::array::c_style | py::array::forcecast> array{};  ///< keeps the converted data alive
+    const T* values{nullptr};
+};
+
+/**
+ * @brief A table of workloads, one workload per row, given by its columns.
+ *
+ * Accepts a dict of 1D arrays (or lists), a NumPy structured array, a pandas DataFrame or a pyarrow Table. The enum
+ * columns hold the integer value of the enum (e.g. int(VPUNN.Operation.CONVOLUTION)). The columns are converted
+ * while the GIL is held, the workloads can then be built and costed without it.
+ */
+class WorkloadsTable {
+public:
+    explicit WorkloadsTable(py::object table): table{std::move(table)} {
+    }
+
+    std::size_t rows() const {
+        return rows_count;
+    }
+
+    bool has(const char* name) const {
+        const py::str key{name};
+        if (py::hasattr(table, "dtype") && !table.attr("dtype").attr("names").is_none()) {  // structured array
+            return table.attr("dtype").attr("names").contains(key);
+        }
+        if (py::hasattr(table, "column_names")) {  // pyarrow Table
+            return table.attr("column_names").contains(key);
+        }
+        return table.contains(key);  // dict, DataFrame
+    }
+
+    template <typename T>
+    Column<T> required(const char* name) {
+        if (!has(name)) {
+            throw py::key_error(std::string("missing workloads column: ") + name);
+        }
+        return Column<T>{convert<T>(name)};
+    }
+
+    template <typename T>
+    Column<T> optional(const char* name) {
+        return has(name) ? Column<T>{convert<T>(name)} : Column<T>{};
+    }
+
+    /// a column of strings, as python list
+    py::list strings(const char* name) {
+        if (!has(name)) {
+            throw py::key_error(std::string("missing workloads column: ") + name);
+        }
+        py::object values{table[py::str(name)]};
+        py::list list{py::hasattr(values, "to_pylist")  ? values.attr("to_pylist")()  // pyarrow
+                      : py::hasattr(values, "tolist") ? values.attr("tolist")()     // NumPy, pandas
+                                                      : values};
+        check_rows(name, list.size());
+        return list;
+    }
+
+private:
+    template <typename T>
+    py::array_t<T, py::array::c_style | py::array::forcecast> convert(const char* name) {
+        py::object values{table[py::str(name)]};
+        if (py::hasattr(values, "to_numpy")) {  // pandas Series, pyarrow ChunkedArray
+            values = values.attr("to_numpy")();
+        }
+        auto array{py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(values)};
+        if (!array || array.ndim() != 1) {
+            throw py::type_error(std::string("workloads column is not a 1D numeric array: ") + name);
+        }
+        check_rows(name, static_cast<std::size_t>(array.size()));
+        return array;
+    }
+
+    void check_rows(const char* name, const std::size_t size) {
+        if (!rows_known) {
+            rows_count = size;
+            rows_known = true;
+        } else if (size != rows_count) {
+            throw py::value_error(std::string("workloads column has another number of rows: ") + name);
+        }
+    }
+
+    py::object table;
+    std::size_t rows_count{0};
+    bool rows_known{false};
+};
+
+using CyclesArray = py::array_t<VPUNN::CyclesInterfaceType>;
+
+CyclesArray to_array(const std::vector<VPUNN::CyclesInterfaceType>& cycles) {
+    CyclesArray result(static_cast<py::ssize_t>(cycles.size()));
+    std::copy(cycles.cbegin(), cycles.cend(), result.mutable_data());
+    return result;
+}
+
+/// the DPU workloads described by a table. Columns (optional ones in brackets):
+/// device, op, input_width, input_height, input_channels, [input_batch], [input_dtype], output_width, output_height,
+/// output_channels, [output_batch], [output_dtype], kernel_width, kernel_height, stride_width, stride_height,
+/// [padding_top], [padding_bottom], [padding_left], [padding_right], execution_mode, [activation_function],
+/// [act_sparsity], [weight_sparsity], [weight_sparsity_enabled], [input_swizzling], [weight_swizzling],
+/// [output_swizzling], [output_write_tiles], [isi_strategy], [weight_type]
+std::vector<VPUNN::DPUWorkload> dpu_workloads(WorkloadsTable& table) {
+    const auto device{table.required<std::int64_t>("device")};
+    const auto op{table.required<std::int64_t>("op")};
+    const auto in_w{table.required<std::int64_t>("input_width")};
+    const auto in_h{table.required<std::int64_t>("input_height")};
+    const auto in_c{table.required<std::int64_t>("input_channels")};
+    const auto in_b{table.optional<std::int64_t>("input_batch")};
+    const auto in_dtype{table.optional<std::int64_t>("input_dtype")};
+    const auto out_w{table.required<std::int64_t>("output_width")};
+    const auto out_h{table.required<std::int64_t>("output_height")};
+    const auto out_c{table.required<std::int64_t>("output_channels")};
+    const auto out_b{table.optional<std::int64_t>("output_batch")};
+    const auto out_dtype{table.optional<std::int64_t>("output_dtype")};
+    const auto kernel_w{table.required<std::int64_t>("kernel_width")};
+    const auto kernel_h{table.required<std::int64_t>("kernel_height")};
+    const auto stride_w{table.required<std::int64_t>("stride_width")};
+    const auto stride_h{table.required<std::int64_t>("stride_height")};
+    const auto pad_top{table.optional<std::int64_t>("padding_top")};
+    const auto pad_bottom{table.optional<std::int64_t>("padding_bottom")};
+    const auto pad_left{table.optional<std::int64_t>("padding_left")};
+    const auto pad_right{table.optional<std::int64_t>("padding_right")};
+    const auto mode{table.required<std::int64_t>("execution_mode")};
+    const auto activation{table.optional<std::int64_t>("activation_function")};
+    const auto act_sparsity{table.optional<float>("act_sparsity")};
+    const auto weight_sparsity{table.optional<float>("weight_sparsity")};
+    const auto weight_sparsity_enabled{table.optional<std::int64_t>("weight_sparsity_enabled")};
+    const auto input_swizzling{table.optional<std::int64_t>("input_swizzling")};
+    const auto weight_swizzling{table.optional<std::int64_t>("weight_swizzling")};
+    const auto output_swizzling{table.optional<std::int64_t>("output_swizzling")};
+    const auto output_write_tiles{table.optional<std::int64_t>("output_write_tiles")};
+    const auto isi_strategy{table.optional<std::int64_t>("isi_strategy")};
+    const auto weight_type{table.optional<std::int64_t>("weight_type")};
+    /// the value of an optional column, or the default (an enum or a number) if the column is absent
+    const auto value = [](const Column<std::int64_t>& column, const std::size_t row, const auto default_value) {
+        return column.present() ? static_cast<decltype(default_value)>(column[row]) : default_value;
+    };
+
+    std::vector<VPUNN::DPUWorkload> workloads(table.rows());
+    py::gil_scoped_release release;  // only the converted columns are read from here
+    for (std::size_t row = 0; row < workloads.size(); row++) {
+        auto& wl{workloads[row]};
+        const auto input_type{value(in_dtype, row, VPUNN::DataType::UINT8)};
+        const auto output_type{value(out_dtype, row, input_type)};
+        wl.device = static_cast<VPUNN::VPUDevice>(device[row]);
+        wl.op = static_cast<VPUNN::Operation>(op[row]);
+        wl.inputs = {VPUNN::VPUTensor(value(in_w, row, 0U), value(in_h, row, 0U), value(in_c, row, 0U),
+                                      value(in_b, row, 1U), input_type)};
+        wl.outputs = {VPUNN::VPUTensor(value(out_w, row, 0U), value(out_h, row, 0U), value(out_c, row, 0U),
+                                       value(out_b, row, 1U), output_type)};
+        wl.kernels = {value(kernel_w, row, 1U), value(kernel_h, row, 1U)};
+        wl.strides = {value(stride_w, row, 1U), value(stride_h, row, 1U)};
+        wl.padding = {value(pad_top, row, 0U), value(pad_bottom, row, 0U), value(pad_left, row, 0U),
+                      value(pad_right, row, 0U)};
+        wl.execution_order = static_cast<VPUNN::ExecutionMode>(mode[row]);
+        wl.activation_function = value(activation, row, VPUNN::ActivationFunction::NONE);
+        wl.act_sparsity = act_sparsity.present() ? act_sparsity[row] : 0.0F;
+        wl.weight_sparsity = weight_sparsity.present() ? weight_sparsity[row] : 0.0F;
+        wl.weight_sparsity_enabled = value(weight_sparsity_enabled, row, std::int64_t{0}) != 0;
+        wl.input_swizzling = {value(input_swizzling, row, wl.input_swizzling[0]),
+                              value(weight_swizzling, row, wl.input_swizzling[1])};
+        wl.output_swizzling = {value(output_swizzling, row, wl.output_swizzling[0])};
+        wl.output_write_tiles = value(output_write_tiles, row, 1U);
+        wl.isi_strategy = value(isi_strategy, row, VPUNN::ISIStrategy::CLUSTERING);
+        if (weight_type.present()) {
+            wl.weight_type = static_cast<VPUNN::DataType>(weight_type[row]);
+        }
+    }
+    return workloads;
+}
+
+/// the SHAVE workloads described by a table. Columns (optional ones in brackets):
+/// name (strings), device, input_width, input_height, input_channels, [input_batch], [input_dtype], output_width,
+/// output_height, output_channels, [output_batch], [output_dtype]
+std::vector<VPUNN::SHAVEWorkload> shave_workloads(WorkloadsTable& table) {
+    const auto names{table.strings("name")};
+    const auto device{table.required<std::int64_t>("device")};
+    const auto in_w{table.required<std::int64_t>("input_width")};
+    const auto in_h{table.required<std::int64_t>("input_height")};
+    const auto in_c{table.required<std::int64_t>("input_channels")};
+    const auto in_b{table.optional<std::int64_t>("input_batch")};
+    const auto in_dtype{table.optional<std::int64_t>("input_dtype")};
+    const auto out_w{table.required<std::int64_t>("output_width")};
+    const auto out_h{table.required<std::int64_t>("output_height")};
+    const auto out_c{table.required<std::int64_t>("output_channels")};
+    const auto out_b{table.optional<std::int64_t>("output_batch")};
+    const auto out_dtype{table.optional<std::int64_t>("output_dtype")};
+
+    std::vector<VPUNN::SHAVEWorkload> workloads;
+    workloads.reserve(table.rows());
+    for (std::size_t row = 0; row < table.rows(); row++) {
+        const auto tensor = [row](const Column<std::int64_t>& w, const Column<std::int64_t>& h,
+                                  const Column<std::int64_t>& c, const Column<std::int64_t>& b,
+                                  const Column<std::int64_t>& dtype) {
+            return VPUNN::VPUTensor(static_cast<unsigned int>(w[row]), static_cast<unsigned int>(h[row]),
+                                    static_cast<unsigned int>(c[row]),
+                                    b.present() ? static_cast<unsigned int>(b[row]) : 1U,
+                                    dtype.present() ? static_cast<VPUNN::DataType>(dtype[row])
+                                                    : VPUNN::DataType::FLOAT16);
+        };
+        workloads.emplace_back(names[row].cast<std::string>(), static_cast<VPUNN::VPUDevice>(device[row]),
+                               std::vector<VPUNN::VPUTensor>{tensor(in_w, in_h, in_c, in_b, in_dtype)},
+                               std::vector<VPUNN::VPUTensor>{tensor(out_w, out_h, out_c, out_b, out_dtype)});
+    }
+    return workloads;
+}
+
+/// the NPU2.7 DMA workloads described by a table. Columns (optional ones in brackets):
+/// device, [num_planes], length, src_width, dst_width, src_stride, dst_stride, [src_plane_stride],
+/// [dst_plane_stride], transfer_direction
+std::vector<VPUNN::DMANNWorkload_NPU27> dma_workloads_npu27(WorkloadsTable& table) {
+    const auto device{table.required<std::int64_t>("device")};
+    const auto num_planes{table.optional<std::int64_t>("num_planes")};
+    const auto length{table.required<std::int64_t>("length")};
+    const auto src_width{table.required<std::int64_t>("src_width")};
+    const auto dst_width{table.required<std::int64_t>("dst_width")};
+    const auto src_stride{table.required<std::int64_t>("src_stride")};
+    const auto dst_stride{table.required<std::int64_t>("dst_stride")};
+    const auto src_plane_stride{table.optional<std::int64_t>("src_plane_stride")};
+    const auto dst_plane_stride{table.optional<std::int64_t>("dst_plane_stride")};
+    const auto direction{table.required<std::int64_t>("transfer_direction")};
+
+    std::vector<VPUNN::DMANNWorkload_NPU27> workloads;
+    workloads.reserve(table.rows());
+    py::gil_scoped_release release;
+    for (std::size_t row = 0; row < table.rows(); row++) {
+        const auto optional_int = [row](const Column<std::int64_t>& column) {
+            return column.present() ? static_cast<int>(column[row]) : 0;
+        };
+        workloads.emplace_back(static_cast<VPUNN::VPUDevice>(device[row]), optional_int(num_planes),
+                               static_cast<int>(length[row]), static_cast<int>(src_width[row]),
+                               static_cast<int>(dst_width[row]), static_cast<int>(src_stride[row]),
+                               static_cast<int>(dst_stride[row]), optional_int(src_plane_stride),
+                               optional_int(dst_plane_stride), static_cast<VPUNN::MemoryDirection>(direction[row]));
+    }
+    return workloads;
+}
+
+/// the NPU4.0/5.0 DMA workloads described by a table. Columns (optional ones in brackets):
+/// device, src_width, dst_width, [num_dim], [num_engine], transfer_direction, and for each extra dimension d in
+/// 0..4: [src_stride_d], [dst_stride_d], [src_dim_size_d], [dst_dim_size_d]
+std::vector<VPUNN::DMANNWorkload_NPU40_50> dma_workloads_npu40_50(WorkloadsTable& table) {
+    using Workload = VPUNN::DMANNWorkload_NPU40_50;
+    const auto device{table.required<std::int64_t>("device")};
+    const auto src_width{table.required<std::int64_t>("src_width")};
+    const auto dst_width{table.required<std::int64_t>("dst_width")};
+    const auto num_dim{table.optional<std::int64_t>("num_dim")};
+    const auto num_engine{table.optional<std::int64_t>("num_engine")};
+    const auto direction{table.required<std::int64_t>("transfer_direction")};
+    struct DimColumns {
+        Column<std::int64_t> src_stride, dst_stride, src_dim_size, dst_dim_size;
+    };
+    std::vector<DimColumns> dims;
+    for (int d = 0; d < Workload::MaxExtraDimensions; d++) {
+        const auto name = [d](const char* prefix) {
+            return std::string(prefix) + std::to_string(d);
+        };
+        dims.push_back({table.optional<std::int64_t>(name("src_stride_").c_str()),
+                        table.optional<std::int64_t>(name("dst_stride_").c_str()),
+                        table.optional<std::int64_t>(name("src_dim_size_").c_str()),
+                        table.optional<std::int64_t>(name("dst_dim_size_").c_str())});
+    }
+
+    std::vector<Workload> workloads;
+    workloads.reserve(table.rows());
+    py::gil_scoped_release release;
+    for (std::size_t row = 0; row < table.rows(); row++) {
+        const auto optional_int = [row](const Column<std::int64_t>& column, const int default_value) {
+            return column.present() ? static_cast<int>(column[row]) : default_value;
+        };
+        Workload wl{static_cast<VPUNN::VPUDevice>(device[row])};
+        wl.src_width = static_cast<int>(src_width[row]);
+        wl.dst_width = static_cast<int>(dst_width[row]);
+        wl.num_dim = optional_int(num_dim, 0);
+        wl.num_engine = static_cast<VPUNN::Num_DMA_Engine>(
+                optional_int(num_engine, static_cast<int>(VPUNN::Num_DMA_Engine::Num_Engine_1)));
+        wl.transfer_direction = static_cast<VPUNN::MemoryDirection>(direction[row]);
+        for (std::size_t d = 0; d < dims.size(); d++) {
+            wl.e_dim[d] = {optional_int(dims[d].src_stride, 0), optional_int(dims[d].dst_stride, 0),
+                           optional_int(dims[d].src_dim_size, 0), optional_int(dims[d].dst_dim_size, 0)};
+        }
+        workloads.push_back(std::move(wl));
+    }
+    return workloads;
+}
+
+/// costs each workload with cost(workload), in parallel on the executor, without the GIL
+template <typename Workload, typename CostFunction>
+CyclesArray cost_each(VPUNN::IExecutor& executor, const std::vector<Workload>& workloads, CostFunction cost) {
+    std::vector<VPUNN::CyclesInterfaceType> cycles(workloads.size());
+    {
+        py::gil_scoped_release release;
+        executor.parallel_for(workloads.size(), [&](const std::size_t idx) {
+            cycles[idx] = cost(workloads[idx]);
+        });
+    }
+    return to_array(cycles);
+}
+
+template <typename DMAWorkload>
+void bind_dma_bulk(py::class_<VPUNN::DMACostModel<DMAWorkload>>& dma_class,
+                   std::vector<DMAWorkload> (*make_workloads)(WorkloadsTable&)) {
+    dma_class.def(
+            "computeCyclesBulk",
+            [make_workloads](VPUNN::DMACostModel<DMAWorkload>& model, const py::object& table,
+                             std::shared_ptr<VPUNN::IExecutor> executor) {
+                WorkloadsTable workloads_table{table};
+                const auto workloads{make_workloads(workloads_table)};
+                VPUNN::SerialExecutor serial{};
+                return cost_each(executor ? *executor : serial, workloads, [&model](const DMAWorkload& wl) {
+                    return model.computeCycles(wl);
+                });
+            },
+            "Calculate the DMA cycles of a table of workloads (dict of arrays, structured array, DataFrame, Arrow "
+            "Table), in parallel on the executor if given. Returns a NumPy array of cycles",
+            py::arg("workloads"), py::arg("executor") = nullptr);
+}
+
+}  // namespace
+
 PYBIND11_MODULE(_VPUNN, m) {
     m.doc() = "Minimal VPUNN Python bindings for DPU and DMA cost modeling";
 
@@ -224,10 +573,37 @@ PYBIND11_MODULE(_VPUNN, m) {
         .def("getDescriptor", &VPUNN::VPUCostModel::getDescriptor,
              "Get the DPU cost model descriptor for a given workload",
              py::arg("workload"))
-       ;
+        .def("DPU_bulk",
+             [](const VPUNN::VPUCostModel& model, const py::object& table) {
+                 WorkloadsTable workloads_table{table};
+                 auto workloads{dpu_workloads(workloads_table)};
+                 std::vector<VPUNN::CyclesInterfaceType> cycles;
+                 {
+                     py::gil_scoped_release release;
+                     cycles = model.DPU(std::move(workloads));  // batched, in parallel on the attached executor
+                 }
+                 return to_array(cycles);
+             },
+             "Calculate the DPU cycles of a table of workloads (dict of arrays, structured array, DataFrame, Arrow "
+             "Table). Returns a NumPy array of cycles",
+             py::arg("workloads"))
+        .def("SHAVE_bulk",
+             [](const VPUNN::VPUCostModel& model, const py::object& table) {
+                 WorkloadsTable workloads_table{table};
+                 const auto workloads{shave_workloads(workloads_table)};
+                 return cost_each(model.get_executor(), workloads, [&model](const VPUNN::SHAVEWorkload& wl) {
+                     return model.SHAVE(wl);
+                 });
+             },
+             "Calculate the SHAVE cycles of a table of workloads, in parallel on the attached executor. Returns a "
+             "NumPy array of cycles",
+             py::arg("workloads"))
+        .def("set_executor", &VPUNN::VPUCostModel::set_executor,
+             "Executor for the internal parallel loops and the bulk costing, None for serial", py::arg("executor"));
 
     // DMACostModel classes for different DMA workload types
-    py::class_<VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU27>>(m, "DMACostModel_NPU27")
+    py::class_<VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU27>> dma_npu27(m, "DMACostModel_NPU27");
+    dma_npu27
         .def(py::init<const std::string&>(), py::arg("model_path"))
         .def("computeCycles", 
              static_cast<VPUNN::CyclesInterfaceType (VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU27>::*)(const VPUNN::DMANNWorkload_NPU27&)>(&VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU27>::computeCycles),
@@ -237,7 +613,8 @@ PYBIND11_MODULE(_VPUNN, m) {
              "Calculate DMA cycles with error message for NPU27 workload",
              py::arg("workload"));
 
-    py::class_<VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU40_50>>(m, "DMACostModel_NPU40_50")
+    py::class_<VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU40_50>> dma_npu40_50(m, "DMACostModel_NPU40_50");
+    dma_npu40_50
         .def(py::init<const std::string&>(), py::arg("model_path"))
         .def("computeCycles", 
              static_cast<VPUNN::CyclesInterfaceType (VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU40_50>::*)(const VPUNN::DMANNWorkload_NPU40_50&)>(&VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU40_50>::computeCycles),
@@ -247,4 +624,123 @@ PYBIND11_MODULE(_VPUNN, m) {
              "Calculate DMA cycles with error message for NPU40/50 workload",
              py::arg("workload"));
 
+    // Bulk costing: workloads given as columns, costed without the GIL, cycles returned as NumPy arrays
+    py::class_<VPUNN::IExecutor, std::shared_ptr<VPUNN::IExecutor>>(m, "Executor")
+        .def("concurrency", &VPUNN::IExecutor::concurrency);
+
+    py::class_<VPUNN::WorkStealingThreadPool, VPUNN::IExecutor, std::shared_ptr<VPUNN::WorkStealingThreadPool>>(
+            m, "WorkStealingThreadPool")
+        .def(py::init([](unsigned int threads) {
+                 return std::make_shared<VPUNN::WorkStealingThreadPool>(
+                         VPUNN::WorkStealingThreadPool::Options{threads, {}});
+             }),
+             "Thread pool for the bulk costing, threads=0 uses the hardware concurrency", py::arg("threads") = 0)
+        .def("get_steals", &VPUNN::WorkStealingThreadPool::get_steals);
+
+    bind_dma_bulk(dma_npu27, &dma_workloads_npu27);
+    bind_dma_bulk(dma_npu40_50, &dma_workloads_npu40_50);
+
+    // Layer and network (DAG) costing
+    py::enum_<VPUNN::VPUTilingStrategy>(m, "VPUTilingStrategy")
+        .value("NONE", VPUNN::VPUTilingStrategy::NONE)
+        .value("SOH_Overlapped", VPUNN::VPUTilingStrategy::SOH_Overlapped)
+        .value("SOK", VPUNN::VPUTilingStrategy::SOK)
+        .value("SOW", VPUNN::VPUTilingStrategy::SOW)
+        .value("SOHW", VPUNN::VPUTilingStrategy::SOHW)
+        .value("SOHK", VPUNN::VPUTilingStrategy::SOHK)
+        .value("SOH_HaloRead", VPUNN::VPUTilingStrategy::SOH_HaloRead)
+        .value("SOHO_K_SWITCH", VPUNN::VPUTilingStrategy::SOHO_K_SWITCH)
+        .value("SOH_K_SWITCH", VPUNN::VPUTilingStrategy::SOH_K_SWITCH)
+        .value("SOK_NO_BROADCAST", VPUNN::VPUTilingStrategy::SOK_NO_BROADCAST)
+        .value("SOK_H_SWITCH", VPUNN::VPUTilingStrategy::SOK_H_SWITCH)
+        .value("SOK_W_SWITCH", VPUNN::VPUTilingStrategy::SOK_W_SWITCH)
+        .value("UNKNOWN", VPUNN::VPUTilingStrategy::UNKNOWN)
+        .export_values();
+
+    py::class_<VPUNN::VPULayerStrategy>(m, "VPULayerStrategy")
+        .def(py::init<>())
+        .def(py::init([](unsigned int nDPUs, unsigned int nSHVs, unsigned int nTiles,
+                         VPUNN::VPUTilingStrategy tiling_strategy, bool input_fetching, bool output_spilling,
+                         bool prefetching) {
+                 return VPUNN::VPULayerStrategy{nDPUs,          nSHVs,           nTiles,     tiling_strategy,
+                                                input_fetching, output_spilling, prefetching};
+             }),
+             py::arg("nDPUs") = 1, py::arg("nSHVs") = 1, py::arg("nTiles") = 1,
+             py::arg("tiling_strategy") = VPUNN::VPUTilingStrategy::NONE, py::arg("input_fetching") = false,
+             py::arg("output_spilling") = false, py::arg("prefetching") = true)
+        .def_readwrite("nDPUs", &VPUNN::VPULayerStrategy::nDPUs)
+        .def_readwrite("nSHVs", &VPUNN::VPULayerStrategy::nSHVs)
+        .def_readwrite("nTiles", &VPUNN::VPULayerStrategy::nTiles)
+        .def_readwrite("tiling_strategy", &VPUNN::VPULayerStrategy::tiling_strategy)
+        .def_readwrite("input_fetching", &VPUNN::VPULayerStrategy::input_fetching)
+        .def_readwrite("output_spilling", &VPUNN::VPULayerStrategy::output_spilling)
+        .def_readwrite("prefetching", &VPUNN::VPULayerStrategy::prefetching);
+
+    // not bound as subclass of DPUWorkload, the holder types differ
+    py::class_<VPUNN::DPULayer, std::shared_ptr<VPUNN::DPULayer>>(m, "DPULayer")
+        .def(py::init<const VPUNN::DPUWorkload&>(), py::arg("workload"));
+
+    py::class_<VPUNN::VPULayerCostModel>(m, "VPULayerCostModel")
+        .def(py::init<const std::string&>(), py::arg("model_path"))
+        .def(py::init([](VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU27>* dma, const std::string& model_path) {
+                 return std::make_unique<VPUNN::VPULayerCostModel>(VPUNN::DMACostModelVariant{dma}, model_path);
+             }),
+             py::keep_alive<1, 2>(), py::arg("dma_model"), py::arg("model_path"))
+        .def(py::init([](VPUNN::DMACostModel<VPUNN::DMANNWorkload_NPU40_50>* dma, const std::string& model_path) {
+                 return std::make_unique<VPUNN::VPULayerCostModel>(VPUNN::DMACostModelVariant{dma}, model_path);
+             }),
+             py::keep_alive<1, 2>(), py::arg("dma_model"), py::arg("model_path"))
+        .def("Layer",
+             [](VPUNN::VPULayerCostModel& model, VPUNN::DPULayer& layer, const VPUNN::VPULayerStrategy& strategy) {
+                 py::gil_scoped_release release;
+                 return model.Layer(layer, strategy);
+             },
+             "Calculate the cycles of a DPU layer with a strategy", py::arg("layer"), py::arg("strategy"))
+        .def("Layers",
+             [](VPUNN::VPULayerCostModel& model, std::vector<VPUNN::DPULayer> layers,
+                const std::vector<VPUNN::VPULayerStrategy>& strategies) {
+                 if (layers.size() != strategies.size()) {
+                     throw py::value_error("Layers: one strategy is needed for each layer");
+                 }
+                 std::vector<VPUNN::CyclesInterfaceType> cycles(layers.size());
+                 {
+                     // one layer after the other, each one splits its tiles on the attached executor
+                     py::gil_scoped_release release;
+                     for (std::size_t idx = 0; idx < layers.size(); idx++) {
+                         cycles[idx] = model.Layer(layers[idx], strategies[idx]);
+                     }
+                 }
+                 return to_array(cycles);
+             },
+             "Calculate the cycles of a list of DPU layers, one strategy per layer. Returns a NumPy array of cycles",
+             py::arg("layers"), py::arg("strategies"))
+        .def("set_executor", &VPUNN::VPULayerCostModel::set_executor,
+             "Executor for the tile splits of a layer, None for serial", py::arg("executor"));
+
+    py::class_<VPUNN::VPUComputeNode, std::shared_ptr<VPUNN::VPUComputeNode>>(m, "VPUComputeNode")
+        .def(py::init<const std::shared_ptr<VPUNN::DPULayer>&>(), py::arg("layer"));
+
+    py::class_<VPUNN::VPUComputationDAG>(m, "VPUComputationDAG")
+        .def(py::init<>())
+        .def("addNode", &VPUNN::VPUComputationDAG::addNode, py::return_value_policy::reference_internal,
+             py::arg("node"))
+        .def("addEdge", &VPUNN::VPUComputationDAG::addEdge, py::return_value_policy::reference_internal,
+             py::arg("source"), py::arg("sink"));
+
+    py::class_<VPUNN::VPUNetworkStrategy>(m, "VPUNetworkStrategy")
+        .def(py::init<>())
+        .def("set", &VPUNN::VPUNetworkStrategy::set, py::return_value_policy::reference_internal, py::arg("node"),
+             py::arg("strategy"));
+
+    py::class_<VPUNN::VPUNetworkCostModel>(m, "VPUNetworkCostModel")
+        .def(py::init<const std::string&>(), py::arg("model_path"))
+        .def("Network",
+             [](VPUNN::VPUNetworkCostModel& model, VPUNN::VPUComputationDAG& dag,
+                VPUNN::VPUNetworkStrategy& strategy) {
+                 py::gil_scoped_release release;
+                 return model.Network(dag, strategy);
+             },
+             "Calculate the cycles of a network, the layers are costed in parallel on the attached executor",
+             py::arg("dag"), py::arg("strategy"))
+        .def("set_executor", &VPUNN::VPUNetworkCostModel::set_executor, py::arg("executor"));
 }
@@ -8,6 +8,7 @@
 // Software Package for additional details.
 
 #include "vpu/dpu_workload.h"
+#include <cmath>
 #include <iostream>
 #include "core/utils.h"
 
@@ -30,19 +31,33 @@ static inline uint32_t hash_float(uint32_t h, float c) {
     return hash_uint32(h, value);
 }
 
+/// Fingerprint variant of hash_uint32
+static inline FingerprintBuilder hash_uint32(FingerprintBuilder h, uint32_t value) {
+    h.add(value);
+    return h;
+}
+
+/// Fingerprint variant of hash_float, keeps the precision used by operator==
+static inline FingerprintBuilder hash_float(FingerprintBuilder h, float c) {
+    h.add(static_cast<uint64_t>(std::llround(static_cast<double>(c) * 100000.0)));
+    return h;
+}
+
 /// Helper function to hash an enum value
-template <typename T>
-static inline uint32_t hash_enum(uint32_t h, T value) {
+template <typename H, typename T>
+static inline H hash_enum(H h, T value) {
     return hash_uint32(h, static_cast<uint32_t>(value));
 }
 
 /// Helper function to hash a boolean value
-static inline uint32_t hash_bool(uint32_t h, bool value) {
+template <typename H>
+static inline H hash_bool(H h, bool value) {
     return hash_uint32(h, value ? 1 : 0);
 }
 
 /// Helper function to hash a VPUTensor
-static inline uint32_t hash_tensor(uint32_t h, const VPUTensor& tensor) {
+template <typename H>
+static inline H hash_tensor(H h, const VPUTensor& tensor) {
     // Hash shape array
     const auto& shape = tensor.get_shape();
     for (const auto& dim : shape) {
@@ -56,7 +71,8 @@ static inline uint32_t hash_tensor(uint32_t h, const VPUTensor& tensor) {
 }
 
 /// Helper function to hash a HaloWorkload
-static inline uint32_t hash_halo(uint32_t h, const HaloWorkload& halo) {
+template <typename H>
+static inline H hash_halo(H h, const HaloWorkload& halo) {
     // Hash input_0_halo info
     h = hash_uint32(h, halo.input_0_halo.top);
     h = hash_uint32(h, halo.input_0_halo.bottom);
@@ -93,7 +109,8 @@ static inline uint32_t hash_halo(uint32_t h, const HaloWorkload& halo) {
 }
 
 /// Helper function to hash a SEPModeInfo
-static inline uint32_t hash_sep(uint32_t h, const SEPModeInfo& sep) {
+template <typename H>
+static inline H hash_sep(H h, const SEPModeInfo& sep) {
     // Hash SEP activators flag
     h = hash_bool(h, sep.sep_activators);
     // Hash SEP storage_elements_pointers shape
@@ -112,8 +129,8 @@ static inline uint32_t hash_sep(uint32_t h, const SEPModeInfo& sep) {
 }
 
 /// Helper function to hash an optional value
-template <typename T>
-static inline uint32_t hash_optional(uint32_t h, const std::optional<T>& opt) {
+template <typename H, typename T>
+static inline H hash_optional(H h, const std::optional<T>& opt) {
     if (opt.has_value()) {
         h = hash_bool(h, true);
         if constexpr (std::is_enum_v<T>) {
@@ -130,8 +147,15 @@ static inline uint32_t hash_optional(uint32_t h, const std::optional<T>& opt) {
 }
 
 uint32_t DPUWorkload::hash() const noexcept {
-    uint32_t h = fnv_offset_basis;
+    return hash_fields(fnv_offset_basis);
+}
+
+Fingerprint128 DPUWorkload::fingerprint() const noexcept {
+    return hash_fields(FingerprintBuilder{}).add(layer_info).result();  // operator== compares also the layer info
+}
 
+template <typename H>
+H DPUWorkload::hash_fields(H h) const noexcept {
     // Hash basic enums
     h = hash_enum(h, device);
     h = hash_enum(h, op);
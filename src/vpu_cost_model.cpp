@@ -10,6 +10,7 @@
 #include "vpu_cost_model.h"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>  // for std::make_shared, std::make_unique
 #include <mutex>
 #include <optional>   // for std::optional (if needed)
@@ -280,9 +281,26 @@ const std::vector<CyclesInterfaceType> VPUCostModel::get_cost(const std::vector<
         });
 
         return cycles_vector;
-    } else {
-        return dpu_nn_cost_provider.get_cost(workloads);  // normal execution
     }
+
+    // normal execution, in chunks that run in parallel (each thread infers with its own execution context)
+    constexpr std::size_t min_chunk_size{32};  // smaller chunks cost more in scheduling than they gain
+    auto& parallel{get_executor()};
+    const std::size_t max_chunks{std::max<std::size_t>(1, workloads.size() / min_chunk_size)};
+    const std::size_t chunks{std::min<std::size_t>(max_chunks, parallel.concurrency())};
+    if (chunks <= 1) {
+        return dpu_nn_cost_provider.get_cost(workloads);
+    }
+
+    std::vector<CyclesInterfaceType> cycles_vector(workloads.size());
+    parallel.parallel_for(chunks, [&](const std::size_t chunk) {
+        const auto begin{workloads.cbegin() + static_cast<std::ptrdiff_t>(workloads.size() * chunk / chunks)};
+        const auto end{workloads.cbegin() + static_cast<std::ptrdiff_t>(workloads.size() * (chunk + 1) / chunks)};
+        const auto chunk_cycles{dpu_nn_cost_provider.get_cost(std::vector<DPUWorkload>(begin, end))};
+        std::copy(chunk_cycles.cbegin(), chunk_cycles.cend(),
+                  cycles_vector.begin() + std::distance(workloads.cbegin(), begin));
+    });
+    return cycles_vector;
 }
 
 std::vector<float> VPUCostModel::getDescriptor(const DPUWorkload& wl) const {
@@ -425,6 +443,10 @@ float VPUCostModel::DPUEnergy(const DPUWorkload& wl) const {
     return getEnergyInterface().DPUEnergy(wl);
 }
 
+std::vector<float> VPUCostModel::DPUEnergy(const std::vector<DPUWorkload>& workloads) const {
+    return getEnergyInterface().DPUEnergy(workloads);
+}
+
 float VPUCostModel::SHAVEEnergy(const SHAVEWorkload& swl) const {
     return getEnergyInterface().SHAVEEnergy(swl);
 }
@@ -177,7 +177,8 @@ const std::vector<std::string> VPULayerCostModel::get_names_for_serializer() {
 CyclesInterfaceType VPULayerCostModel::layer_cycles(VPUCostModel& dpu_cost_provider, DPULayer& layer,
                                                     VPUTilingStrategy strategy, unsigned int nDPU, unsigned int nTiles,
                                                     bool input_in_ddr, bool output_in_ddr, bool prefetching,
-                                                    LayerSplitInfo* detailed_split) const {
+                                                    LayerSplitInfo* detailed_split,
+                                                    IntraTileSplitMemo* tile_memo) const {
     dpu_cost_provider.swizzling_turn_OFF(layer);
 
     if (nTiles == 0) {
@@ -205,7 +206,13 @@ CyclesInterfaceType VPULayerCostModel::layer_cycles(VPUCostModel& dpu_cost_provi
     // split the layer section, all splits
     {
         operation_sanitisation(layer);  // AVEPOOL will be transformed to something equivalent
-        const SplitOptions options{maxWorkloadsPerIntraTileSplit, 0, nDPU};  // here always for LATENCY => cycles
+        SplitOptions options{maxWorkloadsPerIntraTileSplit, 0, nDPU};  // here always for LATENCY => cycles
+        options.pruneSplits = pruneIntraTileSplits;
+        // only the splits consumed by the caller, all for the serializer (it writes each one)
+        options.detailLevel = (detailed_split == nullptr)                          ? SplitDetailLevel::NONE
+                              : serialization_handler.needs_all_intra_tile_splits() ? SplitDetailLevel::ALL
+                                                                                    : splitDetailLevel;
+        options.detailTopK = splitDetailTopK;
 
         {  // the layer must be verified to be valid
             SanityReport unsplit_result;
@@ -265,19 +272,17 @@ CyclesInterfaceType VPULayerCostModel::layer_cycles(VPUCostModel& dpu_cost_provi
         }  // inter tile layers sanitized and validated
 
         // VPUCostModel& dpu_cost_provider(*this);       // this is the cost provider for the DPU workloads
-        auto tiler = getDPUTiler(dpu_cost_provider);  // intra-tile tiler
-        for (auto& one_tile_layer : tiles_layer) {
+        // obtains the best DPU workloads split of a tile. On exception the tile has the error result
+        // ERROR_TILE_SPLIT_EXCEPTION and no workloads, and is_split is false
+        const auto split_tile = [&](const DPULayer& one_tile_layer, bool& is_split) -> OneTileLayerInfo {
+            is_split = false;
             try {
-                // obtains the best DPU workloads split
+                auto tiler = getDPUTiler(dpu_cost_provider);  // intra-tile tiler, one for each (parallel) tile
                 std::vector<DPUWorkloadsWithCyclesSplit> splits;
-                const DPUWorkloadsCost cost_and_workloads = tiler->intraTileSplit(one_tile_layer, options, &splits);
-                const auto cycles = cost_and_workloads.first;
-                tiles_cost.push_back(cycles);
-
-                if (detailed_split) {
-                    detailed_split->emplace_back(
-                            OneTileLayerInfo{one_tile_layer, std::move(cost_and_workloads), std::move(splits)});
-                }
+                DPUWorkloadsCost cost_and_workloads = tiler->intraTileSplit(
+                        one_tile_layer, options, (options.detailLevel != SplitDetailLevel::NONE) ? &splits : nullptr);
+                is_split = true;
+                return OneTileLayerInfo{one_tile_layer, std::move(cost_and_workloads), std::move(splits)};
             } catch (const std::exception& e) {
                 Logger::warning() << "\n Exception thrown while performing intra tile split "
                                   << "\n Exception: " << e.what() << "\n " << layer << " \n strategy: " << (int)strategy
@@ -285,12 +290,46 @@ CyclesInterfaceType VPULayerCostModel::layer_cycles(VPUCostModel& dpu_cost_provi
                                   << "\nResult: this tile will have error result ERROR_TILE_SPLIT_EXCEPTION: "
                                   << (CyclesInterfaceType)Cycles::ERROR_TILE_SPLIT_EXCEPTION << " \n";
 
-                // add the error result
                 (void)e;
-                tiles_cost.push_back((CyclesInterfaceType)Cycles::ERROR_TILE_SPLIT_EXCEPTION);  // big value
+                return OneTileLayerInfo{one_tile_layer,
+                                        {(CyclesInterfaceType)Cycles::ERROR_TILE_SPLIT_EXCEPTION, {}}};  // big value
+            }
+        };
+
+        if (tile_memo) {
+            // serial, a tile may be the same as one split just before (e.g. the tiles of SOK)
+            for (auto& one_tile_layer : tiles_layer) {
+                // a tile already split in this session is not split again
+                const OneTileLayerInfo* known_tile{tile_memo->find(one_tile_layer, options)};
+                if (known_tile) {
+                    tiles_cost.push_back(known_tile->best_intra_tile_split.first);
+                    if (detailed_split) {
+                        detailed_split->emplace_back(*known_tile);
+                    }
+                    continue;
+                }
+
+                bool is_split{false};
+                OneTileLayerInfo tile_info{split_tile(one_tile_layer, is_split)};
+                tiles_cost.push_back(tile_info.best_intra_tile_split.first);
+                if (is_split) {
+                    tile_memo->insert(one_tile_layer, options, tile_info);
+                }
                 if (detailed_split) {
-                    detailed_split->emplace_back(
-                            OneTileLayerInfo{one_tile_layer, {tiles_cost.back(), {}}});  // no workloads info
+                    detailed_split->emplace_back(std::move(tile_info));
+                }
+            }
+        } else {
+            // the tiles are independent, split in parallel by the executor of the cost model
+            std::vector<OneTileLayerInfo> tiles_info(tiles_layer.size());
+            dpu_cost_provider.get_parallel_executor().parallel_for(tiles_layer.size(), [&](const std::size_t idx) {
+                bool is_split{false};
+                tiles_info[idx] = split_tile(tiles_layer[idx], is_split);
+            });
+            for (auto& tile_info : tiles_info) {
+                tiles_cost.push_back(tile_info.best_intra_tile_split.first);
+                if (detailed_split) {
+                    detailed_split->emplace_back(std::move(tile_info));
                 }
             }
         }
@@ -305,8 +344,10 @@ CyclesInterfaceType VPULayerCostModel::layer_cycles(VPUCostModel& dpu_cost_provi
 
     // serialize the complete detailed splits
     // should DO ONLY if no previous serialization error! Think about how to handler these situations
-    serialization_handler.serializeLayerSplitInfo(tiles_layer.size(),
-                                                  *detailed_split);  // info with cluster_ not with /#
+    if (detailed_split) {  // always present when serializing
+        serialization_handler.serializeLayerSplitInfo(tiles_layer.size(),
+                                                      *detailed_split);  // info with cluster_ not with /#
+    }
 
     if (!Cycles::isErrorCode(cost)) {
         if (!prefetching) {
@@ -403,7 +444,13 @@ CyclesInterfaceType VPULayerCostModel::layer_pre_split_cycles(
     // split the layer section, all splits
     {
         // operation_sanitisation(layer);  // AVEPOOL will be transformed to something equivalent
-        const SplitOptions options{maxWorkloadsPerIntraTileSplit, 0, nDPU};  // here always for LATENCY => cycles
+        SplitOptions options{maxWorkloadsPerIntraTileSplit, 0, nDPU};  // here always for LATENCY => cycles
+        options.pruneSplits = pruneIntraTileSplits;
+        // only the splits consumed by the caller, all for the serializer (it writes each one)
+        options.detailLevel = (detailed_split == nullptr)                          ? SplitDetailLevel::NONE
+                              : serialization_handler.needs_all_intra_tile_splits() ? SplitDetailLevel::ALL
+                                                                                    : splitDetailLevel;
+        options.detailTopK = splitDetailTopK;
 
         // split the layer across multiple tiles
         // tiles_layer = layer.splitAcrossTiles(strategy, nTiles);  // max each tile a layer
@@ -454,7 +501,8 @@ CyclesInterfaceType VPULayerCostModel::layer_pre_split_cycles(
                 std::vector<DPUWorkloadsWithCyclesSplit>
                         all_intra_tile_splits{};  ///< all intra tile splits generated. one pair() is a split
                 const DPUWorkloadsCost cost_and_workloads = tiler->intraTileSplit(
-                        one_tile_layer, options, detailed_split ? &all_intra_tile_splits : nullptr);
+                        one_tile_layer, options,
+                        (options.detailLevel != SplitDetailLevel::NONE) ? &all_intra_tile_splits : nullptr);
                 const auto cycles = cost_and_workloads.first;
                 tiles_cost.push_back(cycles);
 
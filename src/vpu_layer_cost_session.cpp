@@ -0,0 +1,42 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include "vpu_layer_cost_session.h"
+
+namespace VPUNN {
+
+VPULayerCostSession::VPULayerCostSession(VPULayerCostModel& layer_model, std::size_t max_tiles)
+        : model{layer_model}, tile_memo{max_tiles} {
+}
+
+CyclesInterfaceType VPULayerCostSession::Layer(DPULayer& layer, const VPULayerStrategy& strategy) {
+    ++layers_costed;
+    return model.layer_cycles(model.internal_dpu_cost_provider, layer, strategy.tiling_strategy, strategy.nDPUs,
+                              strategy.nTiles, strategy.input_fetching, strategy.output_spilling,
+                              strategy.prefetching, nullptr, &tile_memo);  // no intra-tile split is kept
+}
+
+CyclesInterfaceType VPULayerCostSession::Layer(DPULayer& layer, const VPULayerStrategy& strategy,
+                                               LayerSplitInfo& detailed_split) {
+    ++layers_costed;
+    return model.layer_cycles(model.internal_dpu_cost_provider, layer, strategy.tiling_strategy, strategy.nDPUs,
+                              strategy.nTiles, strategy.input_fetching, strategy.output_spilling,
+                              strategy.prefetching, &detailed_split, &tile_memo);
+}
+
+VPULayerCostSession::Stats VPULayerCostSession::get_stats() const {
+    return {layers_costed, tile_memo.get_misses(), tile_memo.get_hits(), tile_memo.size()};
+}
+
+void VPULayerCostSession::clear() {
+    tile_memo.clear();
+    layers_costed = 0;
+}
+
+}  // namespace VPUNN
@@ -9,19 +9,32 @@
 
 #include "vpu_network_cost_model.h"
 
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 #include "vpu/cycles_interface_types.h"
 
 namespace VPUNN {
 
 unsigned long int VPUNetworkCostModel::Network(VPUComputationDAG& dag, VPUNetworkStrategy& strategy) {
-    unsigned long int cost = 0;
+    std::vector<std::pair<std::shared_ptr<VPUComputeNode>, VPULayerStrategy*>> layers;  // with their strategy
     for (auto layer : dag) {
-        if (strategy.exists(layer)) {
-            cost = Cycles::cost_adder(cost, layer->cycles(*this, strategy[layer]));
-        } else {
+        if (!strategy.exists(layer)) {
             throw_error<std::runtime_error>("Impossible to find a strategy for a layer");
         }
+        layers.emplace_back(layer, &strategy[layer]);
+    }
+
+    // the layers are costed independently, in parallel by the executor of the cost model
+    std::vector<unsigned int> layers_cost(layers.size());
+    get_parallel_executor().parallel_for(layers.size(), [&](const std::size_t idx) {
+        layers_cost[idx] = layers[idx].first->cycles(*this, *layers[idx].second);
+    });
+
+    unsigned long int cost = 0;
+    for (const auto layer_cost : layers_cost) {
+        cost = Cycles::cost_adder(cost, layer_cost);
     }
 
     return cost;
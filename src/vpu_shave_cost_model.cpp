@@ -12,17 +12,21 @@
 #include <cmath>
 #include <memory>  // for std::shared_ptr, std::move
 #include <string>  // for std::string
+#include "core/shared_registry.h"
 #include "vpu/cycles_interface_types.h"
 #include "vpu/shave/shave_cost_providers/shave_provider_bundles.h"
 
 namespace VPUNN {
 
 std::shared_ptr<IShaveCostProvider> SHAVECostModel::createDefaultCostProvider() {
-    return  // select by commenting or un-commenting the desired provider
-            ShaveCostProviderBundles::createDeviceMappedProvider()  // for updated approach
-            // ShaveCostProviderBundles::createOldShaveOnlyProvider()  // activate this for legacy non heuristic
-            // behaviors
-            ;
+    // the provider has only const methods, all the models created while one is alive share it
+    return SharedRegistry<IShaveCostProvider>::instance().get("default_shave_provider", []() {
+        return  // select by commenting or un-commenting the desired provider
+                ShaveCostProviderBundles::createDeviceMappedProvider()  // for updated approach
+                // ShaveCostProviderBundles::createOldShaveOnlyProvider()  // activate this for legacy non heuristic
+                // behaviors
+                ;
+    });
 }
 
 SHAVECostModel::SHAVECostModel(const std::string& cache_filename, const unsigned int cache_size)
@@ -376,11 +376,84 @@ TEST_F(VPUNNSerializerTest, Has_member_map_Test) {
     // DMANNWorkload_NPU40_50
     EXPECT_TRUE(has_member_map_v<DMANNWorkload_NPU40>);
 
-    //DPUOperation
-    EXPECT_TRUE(has_member_map_v<DPUOperation>);
+    // DPUOperation and SHAVEOperation use compile time field tables instead of member maps
+    EXPECT_FALSE(has_member_map_v<DPUOperation>);
+    EXPECT_TRUE(has_member_fields_v<DPUOperation>);
 
-    //SHAVEOperation
-    EXPECT_TRUE(has_member_map_v<SHAVEOperation>);
+    EXPECT_FALSE(has_member_map_v<SHAVEOperation>);
+    EXPECT_TRUE(has_member_fields_v<SHAVEOperation>);
+}
+
+TEST_F(VPUNNSerializerTest, Serialize_Deserialize_DpuOperation_AllFields) {
+    serializer->initialize("test_dpu_op_deserialize_all", FileMode::READ_WRITE, DPUOperation::_get_member_names());
+    EXPECT_TRUE(serializer->is_initialized());
+
+    VPUNN::DPUWorkload wl = {
+            VPUNN::VPUDevice::NPU_5_0,
+            VPUNN::Operation::CONVOLUTION,
+            {VPUNN::VPUTensor(28, 14, 64, 1, VPUNN::DataType::FLOAT16)},  // input dimensions
+            {VPUNN::VPUTensor(14, 7, 32, 1, VPUNN::DataType::UINT8)},     // output dimensions
+            {3, 3},                                                       // kernels
+            {2, 2},                                                       // strides
+            {1, 0, 1, 0},                                                 // padding
+            VPUNN::ExecutionMode::CUBOID_8x16                             // execution mode
+    };
+    wl.act_sparsity = 0.25f;
+    wl.halo.input_0_halo.top = 2;
+    wl.halo.output_0_inbound_halo.back = 3;
+    wl.sep_activators.sep_activators = true;
+    wl.sep_activators.storage_elements_pointers = {4, 5, 6, 1};
+
+    const DPUOperation orig_dpu_op(wl);
+    serializer->serialize(orig_dpu_op);
+    serializer->end();
+
+    serializer->jump_to_beginning();
+
+    DPUOperation deserialized_dpu_op;
+    EXPECT_TRUE(serializer->deserialize(deserialized_dpu_op));
+
+    EXPECT_EQ(orig_dpu_op.device, deserialized_dpu_op.device);
+    EXPECT_EQ(orig_dpu_op.operation, deserialized_dpu_op.operation);
+    EXPECT_EQ(orig_dpu_op.input_0.width, deserialized_dpu_op.input_0.width);
+    EXPECT_EQ(orig_dpu_op.input_0.datatype, deserialized_dpu_op.input_0.datatype);
+    EXPECT_EQ(orig_dpu_op.output_0.channels, deserialized_dpu_op.output_0.channels);
+    EXPECT_EQ(orig_dpu_op.kernel.stride_width, deserialized_dpu_op.kernel.stride_width);
+    EXPECT_EQ(orig_dpu_op.execution_order, deserialized_dpu_op.execution_order);
+    EXPECT_FLOAT_EQ(orig_dpu_op.input_0.sparsity, deserialized_dpu_op.input_0.sparsity);
+    EXPECT_EQ(orig_dpu_op.halo, deserialized_dpu_op.halo);
+    EXPECT_EQ(orig_dpu_op.sep_activators, deserialized_dpu_op.sep_activators);
+
+    EXPECT_EQ(orig_dpu_op.hash(), deserialized_dpu_op.hash());
+    EXPECT_EQ(orig_dpu_op.hash(), DPUOperation(orig_dpu_op).hash());
+}
+
+TEST_F(VPUNNSerializerTest, DpuOperation_FieldTable) {
+    const auto& fields = DPUOperation::_get_member_fields();
+    const auto& names = DPUOperation::_get_member_names();
+    ASSERT_EQ(fields.size(), names.size());
+
+    std::unordered_set<std::string> unique(names.cbegin(), names.cend());
+    EXPECT_EQ(unique.size(), names.size()) << "field names must be unique";
+
+    const DPUWorkload wl = {
+            VPUNN::VPUDevice::VPU_2_7,
+            VPUNN::Operation::ELTWISE,
+            {VPUNN::VPUTensor(16, 16, 64, 1, VPUNN::DataType::UINT8)},  // input dimensions
+            {VPUNN::VPUTensor(16, 16, 64, 1, VPUNN::DataType::UINT8)},  // output dimensions
+            {1, 1},                                                     // kernels
+            {1, 1},                                                     // strides
+            {0, 0, 0, 0},                                               // padding
+            VPUNN::ExecutionMode::CUBOID_16x16                          // execution mode
+    };
+    const DPUOperation op(wl);
+    EXPECT_EQ(fields[0].to_text(op), "VPUDevice.VPU_2_7");
+    EXPECT_EQ(fields[1].to_text(op), "Operation.ELTWISE");
+
+    DPUOperation other(wl);
+    EXPECT_EQ(op.hash(), other.hash());
+    other.output_0.channels = 32;
+    EXPECT_NE(op.hash(), other.hash());
 }
 
 }  // namespace VPUNN_unit_tests
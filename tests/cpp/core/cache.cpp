@@ -121,6 +121,107 @@ TEST_F(VPUNNCacheTest, CacheBasicTest_ext) {
     //}
 }
 
+TEST_F(VPUNNCacheTest, FingerprintMode_SameContentAsFullKey) {
+    DPU_LRU_Cache full_key(50, "");
+    DPU_LRU_Cache fingerprint(50, "");
+    ASSERT_EQ(full_key.set_key_mode(CacheKeyMode::FULL_KEY), CacheKeyMode::FULL_KEY);
+    ASSERT_EQ(fingerprint.set_key_mode(CacheKeyMode::FINGERPRINT, true), CacheKeyMode::FINGERPRINT);
+
+    // 80 different descriptors in a random sequence of adds and gets, evictions happen in both caches the same
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> key_gen(0, 79);
+    std::uniform_int_distribution<int> op_gen(0, 1);
+    auto descriptor = [](int key) {
+        std::vector<float> v(60, 0.5f);
+        v[key % 60] = static_cast<float>(key);
+        v[59] = (key >= 60) ? 0.25f : 0.75f;
+        return v;
+    };
+
+    for (int i = 0; i < 5000; i++) {
+        const int key{key_gen(gen)};
+        const auto v{descriptor(key)};
+        if (op_gen(gen) == 0) {
+            full_key.add(v, static_cast<float>(key));
+            fingerprint.add(v, static_cast<float>(key));
+        } else {
+            const auto expected{full_key.get(v)};
+            const auto actual{fingerprint.get(v)};
+            ASSERT_EQ(actual.has_value(), expected.has_value()) << "step: " << i << " key: " << key;
+            if (expected) {
+                EXPECT_EQ(*actual, *expected);
+            }
+        }
+        ASSERT_EQ(fingerprint.size(), full_key.size());
+    }
+    EXPECT_EQ(fingerprint.size(), 50U);
+    EXPECT_EQ(fingerprint.get_fingerprint_collisions(), 0U);
+
+    // back to full keys, the content is dropped
+    EXPECT_EQ(fingerprint.set_key_mode(CacheKeyMode::FULL_KEY), CacheKeyMode::FULL_KEY);
+    EXPECT_EQ(fingerprint.size(), 0U);
+}
+
+TEST_F(VPUNNCacheTest, FingerprintMode_DPUWorkloadKeys) {
+    LRUCache<DPUWorkload, float> cache(10, "");
+    ASSERT_EQ(cache.set_key_mode(CacheKeyMode::FINGERPRINT, true), CacheKeyMode::FINGERPRINT);
+
+    DPUWorkload wl{VPUDevice::VPU_2_7,
+                   Operation::CONVOLUTION,
+                   {VPUTensor(56, 56, 16, 1, DataType::UINT8)},  // input dimensions
+                   {VPUTensor(56, 56, 16, 1, DataType::UINT8)},  // output dimensions
+                   {3, 3},                                       // kernels
+                   {1, 1},                                       // strides
+                   {1, 1, 1, 1},                                 // padding
+                   ExecutionMode::CUBOID_16x16};
+    wl.act_sparsity = 0.121f;
+    DPUWorkload close_sparsity{wl};
+    close_sparsity.act_sparsity = 0.124f;  // same hash() (percents), different workload
+    DPUWorkload other_name{wl};
+    other_name.set_layer_info("other layer");  // different key, like for operator==
+
+    EXPECT_EQ(wl.hash(), close_sparsity.hash());
+    EXPECT_NE(wl.fingerprint(), close_sparsity.fingerprint());
+    EXPECT_NE(wl.fingerprint(), other_name.fingerprint());
+    EXPECT_EQ(wl.fingerprint(), DPUWorkload{wl}.fingerprint());
+
+    cache.add(wl, 100.0f);
+    EXPECT_FALSE(cache.get(close_sparsity));
+    cache.add(close_sparsity, 200.0f);
+    ASSERT_TRUE(cache.get(wl));
+    EXPECT_EQ(*cache.get(wl), 100.0f);
+    EXPECT_FALSE(cache.get(other_name));
+    ASSERT_TRUE(cache.get(close_sparsity));
+    EXPECT_EQ(*cache.get(close_sparsity), 200.0f);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.get_fingerprint_collisions(), 0U);
+}
+
+TEST(FingerprintLRUStoreTest, EvictsLeastRecentlyUsed) {
+    FingerprintLRUStore<int, int> store(3, false);
+    auto fp = [](int key) {
+        return FingerprintBuilder{}.add(static_cast<std::uint64_t>(key)).result();
+    };
+    for (int key = 0; key < 3; key++) {
+        store.add(fp(key), key, key * 10);
+    }
+    EXPECT_EQ(*store.get(fp(0), 0), 0);  // 1 is now the least recently used
+    store.add(fp(3), 3, 30);
+    EXPECT_FALSE(store.get(fp(1), 1));
+    EXPECT_EQ(*store.get(fp(0), 0), 0);
+    EXPECT_EQ(*store.get(fp(2), 2), 20);
+    EXPECT_EQ(*store.get(fp(3), 3), 30);
+    EXPECT_EQ(store.size(), 3U);
+
+    // many evictions, the index stays consistent
+    for (int key = 4; key < 1000; key++) {
+        store.add(fp(key), key, key * 10);
+        ASSERT_EQ(*store.get(fp(key), key), key * 10);
+        ASSERT_EQ(*store.get(fp(key - 1), key - 1), (key - 1) * 10);
+        ASSERT_FALSE(store.get(fp(key - 3), key - 3));
+    }
+}
+
 //------
 
 class VPUNNCachePreloadedTest : public testing::Test {
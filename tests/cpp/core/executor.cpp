@@ -0,0 +1,102 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include "core/executor.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace VPUNN_unit_tests {
+using namespace VPUNN;
+
+TEST(ExecutorTest, Serial_RunsInOrder) {
+    SerialExecutor serial;
+    EXPECT_EQ(serial.concurrency(), 1U);
+
+    std::vector<std::size_t> order;
+    serial.parallel_for(5, [&order](const std::size_t idx) {
+        order.push_back(idx);
+    });
+    EXPECT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ExecutorTest, WorkStealing_EachIterationOnce) {
+    WorkStealingThreadPool pool{WorkStealingThreadPool::Options{3}};
+    EXPECT_EQ(pool.concurrency(), 4U);
+
+    for (const std::size_t count : {0U, 1U, 7U, 1000U}) {
+        std::vector<std::atomic<int>> runs(count);
+        pool.parallel_for(count, [&runs](const std::size_t idx) {
+            runs[idx].fetch_add(1);
+        });
+        for (std::size_t idx = 0; idx < count; idx++) {
+            EXPECT_EQ(runs[idx].load(), 1) << "iteration " << idx << " of " << count;
+        }
+    }
+}
+
+TEST(ExecutorTest, WorkStealing_NestedAndUneven) {
+    WorkStealingThreadPool pool{WorkStealingThreadPool::Options{2}};
+
+    // the inner loops run also from the workers, the first rows have much more work than the others
+    constexpr std::size_t rows{16};
+    std::vector<std::size_t> row_sums(rows, 0);
+    pool.parallel_for(rows, [&](const std::size_t row) {
+        const std::size_t columns{(row < 2) ? 2000U : 10U};
+        std::vector<std::size_t> values(columns, 0);
+        pool.parallel_for(columns, [&values](const std::size_t col) {
+            values[col] = col;
+        });
+        row_sums[row] = std::accumulate(values.cbegin(), values.cend(), std::size_t{0});
+    });
+
+    for (std::size_t row = 0; row < rows; row++) {
+        const std::size_t columns{(row < 2) ? 2000U : 10U};
+        EXPECT_EQ(row_sums[row], columns * (columns - 1) / 2) << "row " << row;
+    }
+}
+
+TEST(ExecutorTest, WorkStealing_Exception) {
+    WorkStealingThreadPool pool{WorkStealingThreadPool::Options{2}};
+
+    std::atomic<std::size_t> runs{0};
+    EXPECT_THROW(pool.parallel_for(100,
+                                   [&runs](const std::size_t idx) {
+                                       runs.fetch_add(1);
+                                       if (idx == 42) {
+                                           throw std::runtime_error("iteration failed");
+                                       }
+                                   }),
+                 std::runtime_error);
+    EXPECT_LE(runs.load(), 100U);
+
+    // the pool is still usable
+    std::atomic<std::size_t> later_runs{0};
+    pool.parallel_for(10, [&later_runs](const std::size_t) {
+        later_runs.fetch_add(1);
+    });
+    EXPECT_EQ(later_runs.load(), 10U);
+}
+
+TEST(ExecutorTest, WorkStealing_CpuAffinity) {
+    WorkStealingThreadPool affine_pool{WorkStealingThreadPool::Options{2, {0}}};  // pinning is best effort
+
+    std::vector<std::size_t> done(50, 0);
+    affine_pool.parallel_for(done.size(), [&done](const std::size_t idx) {
+        done[idx] = idx + 1;
+    });
+    for (std::size_t idx = 0; idx < done.size(); idx++) {
+        EXPECT_EQ(done[idx], idx + 1);
+    }
+}
+
+}  // namespace VPUNN_unit_tests
@@ -10,7 +10,10 @@
 #include "kernels/kNN.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
 #include "core/tensors.h"
 
 /// @brief namespace for Unit tests of the C++ library
@@ -57,4 +60,64 @@ TEST_F(TestkNNOneHot, BasicAssertions) {
     }
 }
 
+
+// Each batch row has its own neighbours, result is the inverse distance weighted average of the k closest targets
+TEST_F(TestkNNOneHot, BatchRowsAndMultipleNeighbours) {
+    const unsigned int items = 7, embedding_size = 5, batch_size = 4, n_neighbours = 3;
+
+    auto weights = VPUNN::Tensor<float>({items, embedding_size}, 0);
+    auto targets = VPUNN::Tensor<float>({items, 1}, 0);
+    for (unsigned int i = 0; i < items; i++) {
+        targets[i] = static_cast<float>(10 * (i + 1));
+        for (unsigned int e = 0; e < embedding_size; e++) {
+            weights.data()[i * embedding_size + e] = static_cast<float>((i * 7 + e * 3) % 5) / 10.0f;
+        }
+    }
+    auto input = VPUNN::Tensor<float>({batch_size, embedding_size}, 0);
+    for (unsigned int b = 0; b < batch_size; b++) {
+        for (unsigned int e = 0; e < embedding_size; e++) {
+            input.data()[b * embedding_size + e] = static_cast<float>((b * 3 + e * 2) % 4) / 10.0f;
+        }
+    }
+    auto output = VPUNN::Tensor<float>({batch_size, 1}, 0);
+
+    kNN(&weights, &targets, &input, &output, n_neighbours);
+
+    for (unsigned int b = 0; b < batch_size; b++) {
+        // reference: brute force distances and full sort
+        std::vector<std::pair<float, unsigned int>> dist;
+        for (unsigned int i = 0; i < items; i++) {
+            float dot = 0;
+            for (unsigned int e = 0; e < embedding_size; e++) {
+                dot += input.data()[b * embedding_size + e] * weights.data()[i * embedding_size + e];
+            }
+            dist.emplace_back(1.0f - dot, i);
+        }
+        std::sort(dist.begin(), dist.end());
+        float sum = 0, prediction = 0;
+        for (unsigned int k = 0; k < n_neighbours; k++) {
+            const float weight = 1.0f / (dist[k].first + 1e-12f);
+            prediction += targets[dist[k].second] * weight;
+            sum += weight;
+        }
+        EXPECT_NEAR(output[b], prediction / sum, 1e-3f) << "batch row: " << b;
+    }
+}
+
+// More neighbours than items are limited to the number of items
+TEST_F(TestkNNOneHot, MoreNeighboursThanItems) {
+    const unsigned int items = 3;
+    auto weights = VPUNN::Tensor<float>({items, items}, 0);
+    auto targets = VPUNN::Tensor<float>({items, 1}, 5.0f);
+    for (unsigned int i = 0; i < items; i++) {
+        weights.data()[i * items + i] = 1.0f;
+    }
+    auto input = VPUNN::Tensor<float>({1, items}, 0);
+    input[1] = 0.5f;
+    auto output = VPUNN::Tensor<float>({1, 1}, 0);
+
+    kNN(&weights, &targets, &input, &output, 10);
+    EXPECT_NEAR(output[0], 5.0f, 1e-4f);  // all targets equal
+}
+
 }  // namespace VPUNN_unit_tests
@@ -0,0 +1,113 @@
+// Copyright © 2024 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+// LEGAL NOTICE: Your use of this software and any required dependent software (the “Software Package”)
+// is subject to the terms and conditions of the software license agreements for the Software Package,
+// which may also include notices, disclaimers, or license terms for third party or open source software
+// included in or with the Software Package, and your use indicates your acceptance of all such terms.
+// Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
+// Software Package for additional details.
+
+#include "core/shared_registry.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "common/nn_models.h"
+#include "inference/vpunn_runtime.h"
+#include "vpu_cost_model.h"
+
+namespace VPUNN_unit_tests {
+using namespace VPUNN;
+
+class SharedRegistryTest : public testing::Test {
+protected:
+    struct Value {
+        int v;
+    };
+    using Registry = SharedRegistry<const Value>;
+};
+
+TEST_F(SharedRegistryTest, SharedWhileHeld_ReloadedAfterRelease) {
+    auto& registry{Registry::instance()};
+    const auto before{registry.get_stats()};
+    int loads{0};
+    auto loader = [&loads]() {
+        ++loads;
+        return std::make_shared<const Value>(Value{loads});
+    };
+
+    auto first{registry.get("SharedWhileHeld", loader)};
+    auto second{registry.get("SharedWhileHeld", loader)};
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(loads, 1);
+
+    auto other{registry.get("SharedWhileHeld_other", loader)};
+    EXPECT_NE(first.get(), other.get());
+    EXPECT_EQ(loads, 2);
+
+    {
+        const auto stats{registry.get_stats()};
+        EXPECT_EQ(stats.loads - before.loads, 2U);
+        EXPECT_EQ(stats.hits - before.hits, 1U);
+        EXPECT_EQ(stats.alive - before.alive, 2U);
+    }
+
+    first.reset();
+    second.reset();
+    EXPECT_EQ(registry.get_stats().alive - before.alive, 1U);
+
+    auto reloaded{registry.get("SharedWhileHeld", loader)};
+    EXPECT_EQ(loads, 3);
+    EXPECT_EQ(reloaded->v, 3);
+}
+
+TEST_F(SharedRegistryTest, FailedLoadIsNotRegistered) {
+    auto& registry{Registry::instance()};
+    EXPECT_THROW(registry.get("FailedLoad",
+                              []() -> std::shared_ptr<const Value> {
+                                  throw std::runtime_error("cannot load");
+                              }),
+                 std::runtime_error);
+
+    auto loaded{registry.get("FailedLoad", []() {
+        return std::make_shared<const Value>(Value{7});
+    })};
+    EXPECT_EQ(loaded->v, 7);
+}
+
+TEST_F(SharedRegistryTest, Identities) {
+    const std::string a{"abcdefghij"};
+    const std::string b{"abcdefghik"};
+    EXPECT_EQ(content_identity(a.data(), a.size()), content_identity(a.data(), a.size()));
+    EXPECT_NE(content_identity(a.data(), a.size()), content_identity(b.data(), b.size()));
+    EXPECT_NE(content_identity(a.data(), a.size()), content_identity(a.data(), a.size() - 1));
+
+    EXPECT_EQ(file_identity("no_such_file.vpunn"), "missing:no_such_file.vpunn");
+    EXPECT_EQ(file_identity(VPU_2_7_MODEL_PATH), file_identity(VPU_2_7_MODEL_PATH));
+}
+
+/// two cost models of the same .vpunn file use one Runtime
+TEST_F(SharedRegistryTest, CostModelsShareTheRuntime) {
+    auto& registry{SharedRegistry<const Runtime>::instance()};
+    const VPUCostModel model1{VPU_2_7_MODEL_PATH};
+    const auto after_first{registry.get_stats()};
+
+    const VPUCostModel model2{VPU_2_7_MODEL_PATH};
+    const auto after_second{registry.get_stats()};
+    EXPECT_EQ(after_second.loads, after_first.loads);
+    EXPECT_EQ(after_second.hits, after_first.hits + 1);
+    EXPECT_EQ(after_second.alive, after_first.alive);
+
+    const DPUWorkload wl{VPUDevice::VPU_2_7,
+                         Operation::CONVOLUTION,
+                         {VPUTensor(56, 56, 16, 1, DataType::UINT8)},
+                         {VPUTensor(56, 56, 16, 1, DataType::UINT8)},
+                         {3, 3},
+                         {1, 1},
+                         {1, 1, 1, 1},
+                         ExecutionMode::CUBOID_16x16};
+    EXPECT_EQ(model1.DPU(wl), model2.DPU(wl));
+}
+
+}  // namespace VPUNN_unit_tests
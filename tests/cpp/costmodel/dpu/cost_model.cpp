@@ -9,6 +9,10 @@
 
 #include "costmodel/cost_model.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 /// @brief namespace for Unit tests of the C++ library
 namespace VPUNN_unit_tests {
 using namespace VPUNN;
@@ -665,4 +669,97 @@ TEST_F(TestCostModel, SEP_smoke_test) {
     }
 }
 
+/// Concurrent single DPU calls with micro batching give the same cycles as without it
+TEST_F(TestCostModel, MicroBatching_ConcurrentDPU) {
+    constexpr int n_threads{8};
+    constexpr int wl_per_thread{40};
+    std::vector<DPUWorkload> workloads(n_threads * wl_per_thread);
+    std::generate(workloads.begin(), workloads.end(), randDPUWorkload(VPUDevice::VPU_2_7));
+
+    VPUCostModel reference_model{VPU_2_7_MODEL_PATH};
+    std::vector<CyclesInterfaceType> expected;
+    for (const auto& wl : workloads) {
+        expected.push_back(reference_model.DPU(wl));
+    }
+
+    VPUCostModel model{VPU_2_7_MODEL_PATH};
+    const auto& provider{model.get_NN_cost_provider()};
+    EXPECT_FALSE(provider.get_micro_batching_stats().has_value());
+    provider.set_micro_batching(MicroBatchingConfig{4, std::chrono::microseconds{2000}});
+
+    std::vector<CyclesInterfaceType> results(workloads.size());
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < wl_per_thread; i++) {
+                const auto idx{static_cast<size_t>(i * n_threads + t)};
+                results[idx] = model.DPU(workloads[idx]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t idx = 0; idx < workloads.size(); idx++) {
+        EXPECT_EQ(results[idx], expected[idx]) << idx << "\n" << workloads[idx];
+    }
+    const auto stats{provider.get_micro_batching_stats()};
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_GT(stats->requests, 0U);
+    EXPECT_LT(stats->batches, stats->requests) << "some inferences must be batched";
+
+    provider.set_micro_batching(std::nullopt);
+    EXPECT_FALSE(provider.get_micro_batching_stats().has_value());
+}
+
+TEST_F(TestCostModel, ExecutionContextPool_ThreadsReuseContexts) {
+    const std::vector<DPUWorkload> workloads(32, wl_glob_27);
+
+    VPUCostModel model{std::string{VPU_2_7_MODEL_PATH}, false, 0};  // no cache, each DPU call infers
+    const auto& provider{model.get_NN_cost_provider()};
+    provider.set_max_pooled_execution_contexts(2);
+    (void)model.DPU(workloads[0]);  // the calling thread keeps its context until it ends
+    const auto before{provider.get_execution_context_stats()};
+    EXPECT_EQ(before.in_use, 1U);
+    EXPECT_EQ(before.pooled, 0U);
+
+    // short lived threads one after the other: a single context is created and then reused
+    for (size_t t = 0; t < 8; t++) {
+        std::thread worker([&model, &workloads, t]() {
+            (void)model.DPU(workloads[t]);
+        });
+        worker.join();
+    }
+    const auto sequential{provider.get_execution_context_stats()};
+    EXPECT_EQ(sequential.created, before.created + 1U);
+    EXPECT_EQ(sequential.reused, before.reused + 7U);
+    EXPECT_EQ(sequential.released, before.released + 8U);
+    EXPECT_EQ(sequential.in_use, 1U);
+    EXPECT_EQ(sequential.pooled, 1U);
+    EXPECT_EQ(sequential.bytes, 2U * before.bytes);
+
+    // concurrent threads: at most max pooled contexts remain after they end
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 6; t++) {
+        threads.emplace_back([&model, &workloads, t]() {
+            for (size_t i = t; i < workloads.size(); i += 6) {
+                (void)model.DPU(workloads[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto concurrent{provider.get_execution_context_stats()};
+    EXPECT_EQ(concurrent.in_use, 1U);
+    EXPECT_LE(concurrent.pooled, 2U);
+    EXPECT_EQ(concurrent.released, sequential.released + 6U);
+    EXPECT_EQ(concurrent.bytes, (concurrent.pooled + 1U) * before.bytes);
+
+    provider.set_max_pooled_execution_contexts(0);
+    EXPECT_EQ(provider.get_execution_context_stats().pooled, 0U);
+    EXPECT_EQ(provider.get_execution_context_stats().bytes, before.bytes);
+}
+
 }  // namespace VPUNN_unit_tests
\ No newline at end of file
@@ -8,6 +8,7 @@
 // Software Package for additional details.
 
 #include "costmodel/cost_model.h"
+#include "vpu_device_cost_model.h"
 
 namespace VPUNN_unit_tests {
 using namespace VPUNN;
@@ -3008,4 +3009,57 @@ TEST_F(TestCostModelVPU2x, MTL_Weigths_types_CONV_NPU27) {
     // EXPECT_TRUE(false);
 }
 
+TEST_F(TestCostModelVPU2x, DeviceCostModel_SameAsGenericModel) {
+    using VPU27CostModel = VPUDeviceCostModel<VPUDevice::VPU_2_7>;
+    static_assert(VPU27CostModel::hw_characteristics.get_nr_macs() == 2048);
+    static_assert(std::is_same_v<VPU27CostModel::ValidValues, VPU2_7_WorkloadValidValues>);
+
+    const VPU27CostModel device_model{model27_path, false, 0};
+    const VPUCostModel generic_model{model27_path, false, 0};
+    ASSERT_TRUE(device_model.nn_initialized());
+
+    std::vector<DPUWorkload> workloads(200);
+    std::generate_n(workloads.begin(), workloads.size(), randDPUWorkload(device27));
+
+    auto avgpool{wl_glob_27};  // replaced by DW_CONV at sanitization
+    avgpool.op = Operation::AVEPOOL;
+    auto compressed_conv{wl_glob_27};  // presumed CM_CONV
+    compressed_conv.inputs[0] = VPUTensor(56, 56, 3, 1, DataType::UINT8);
+    auto too_big{wl_glob_27};  // does not fit in CMX
+    too_big.inputs[0] = VPUTensor(1000, 1000, 64, 1, DataType::UINT8);
+    too_big.outputs[0] = VPUTensor(1000, 1000, 64, 1, DataType::UINT8);
+    // workloads of other devices take the generic path
+    workloads.insert(workloads.end(), {avgpool, compressed_conv, too_big, wl_glob_20, wl_glob_40});
+
+    // cycles and info, or the exception text (some random workloads cannot be described to the NN)
+    auto run = [](const auto& model, const DPUWorkload& wl) {
+        std::string info;
+        try {
+            return std::to_string(model.DPU(wl, info)) + " " + info;
+        } catch (const std::exception& e) {
+            return std::string{"exception: "} + e.what();
+        }
+    };
+    for (const auto& wl : workloads) {
+        EXPECT_EQ(run(device_model, wl), run(generic_model, wl)) << wl;
+    }
+}
+
+/// the construction phases are measured, only the preprocessor of the model is created
+TEST_F(TestCostModelVPU2x, StartupTimes_Breakdown) {
+    const VPUCostModel model{model27_path, false, 0};
+    ASSERT_TRUE(model.nn_initialized());
+
+    const auto& times{model.get_NN_cost_provider().get_startup_times()};
+    std::vector<std::string> names;
+    for (const auto& phase : times.phases()) {
+        names.push_back(phase.first);
+        EXPECT_GE(phase.second, 0.0) << phase.first;
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"runtime", "preprocessing", "cache", "new_cache", "checks",
+                                               "serializer"}));
+    EXPECT_GE(times.total(), times.phases().front().second);
+    EXPECT_NE(times.to_string().find("total: "), std::string::npos);
+}
+
 }  // namespace VPUNN_unit_tests
\ No newline at end of file
@@ -80,4 +80,25 @@ TEST_F(RuntimeProcessingFactoryTest, SimpleChecks) {
     }
 }
 
+/// the preprocessors are created only when requested, once per version
+TEST_F(RuntimeProcessingFactoryTest, LazyCreation) {
+    const VPUNN::RuntimeProcessingFactory factory;
+    EXPECT_EQ(factory.created_count(), 0U);
+    EXPECT_TRUE(factory.exists_preprocessing((int)VPUNN::NNVersions::VERSION_11_VPU27_BETA));
+    EXPECT_EQ(factory.created_count(), 0U);
+
+    const int v = (int)VPUNN::NNVersions::VERSION_11_VPU27_BETA;
+    auto& pp1 = factory.make_preprocessing(v);
+    auto& pp2 = factory.make_preprocessing(v);
+    EXPECT_EQ(&pp1, &pp2);
+    EXPECT_EQ(factory.created_count(), 1U);
+
+    auto& pp3 = factory.make_preprocessing((int)VPUNN::NNVersions::VERSION_11_NPU40);
+    EXPECT_NE(&pp1, &pp3);
+    EXPECT_EQ(factory.created_count(), 2U);
+
+    EXPECT_ANY_THROW(factory.make_preprocessing(2));
+    EXPECT_EQ(factory.created_count(), 2U);
+}
+
 }  // namespace VPUNN_unit_tests
@@ -17,6 +17,9 @@
 #include <numeric>
 #include <vector>
 #include "common/common_helpers.h"
+#include "inference/precision_validation.h"
+#include "vpu/sample_generator/random_task_generator.h"
+#include "vpu_cost_model.h"
 
 namespace VPUNN_unit_tests {
 using namespace VPUNN;
@@ -124,4 +127,41 @@ TEST_F(TestRuntime, CreationBasicTest) {
     }
 }
 
+/// Deviation of the shipped DPU models with reduced precision weights. BF16 stays within 1% on average, INT8 is
+/// reported (about 10% on average for these models) but has to be chosen per model based on this kind of check
+TEST_F(TestRuntime, ReducedPrecision_DeviationFromFP32) {
+    for (const auto& [model_file, device] : {std::make_pair(std::string{VPU_2_7_MODEL_PATH}, VPUDevice::VPU_2_7),
+                                             std::make_pair(std::string{VPU_4_0_MODEL_PATH}, VPUDevice::VPU_4_0)}) {
+        const VPUCostModel cost_model{model_file};
+        ASSERT_TRUE(cost_model.nn_initialized()) << model_file;
+
+        std::vector<std::vector<float>> descriptors;
+        randDPUWorkload generator{device};
+        for (int i = 0; i < 300; i++) {
+            descriptors.push_back(cost_model.getDescriptor(generator()));
+        }
+
+        const PrecisionValidator validator{model_file};
+        ASSERT_TRUE(validator.is_initialized());
+
+        const auto fp32{validator.compare(WeightsPrecision::FP32, descriptors)};
+        EXPECT_EQ(fp32.samples, descriptors.size());
+        EXPECT_EQ(fp32.max_abs, 0.0f) << fp32;
+
+        const auto bf16{validator.compare(WeightsPrecision::BF16, descriptors)};
+        const auto int8{validator.compare(WeightsPrecision::INT8, descriptors)};
+        std::cout << model_file << "\n  " << bf16 << "\n  " << int8 << "\n";
+
+        EXPECT_EQ(bf16.samples, descriptors.size());
+        EXPECT_GT(bf16.max_abs, 0.0f) << "must run with other weights";
+        EXPECT_LT(bf16.mean_rel, 0.01f) << bf16;
+        EXPECT_EQ(int8.samples, descriptors.size());
+        EXPECT_GT(int8.max_abs, 0.0f) << "must run with other weights";
+        EXPECT_LT(int8.mean_rel, 0.5f) << int8;
+
+        const Runtime reduced{model_file, false, WeightsPrecision::INT8};
+        EXPECT_EQ(reduced.weights_precision(), WeightsPrecision::INT8);
+    }
+}
+
 }  // namespace VPUNN_unit_tests
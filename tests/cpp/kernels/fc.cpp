@@ -7,10 +7,13 @@
 // Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
 // Software Package for additional details.
 
+#include "kernels/bias.h"
 #include "kernels/fully_connected.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
 #include <vector>
@@ -59,4 +62,99 @@ TEST_F(TestFCLayer, BasicAssertions) {
         }
     }
 }
+
+TEST_F(TestFCLayer, PackedWeights_SameAsDenseAndBias) {
+    for (unsigned int batch_size : {1U, 3U, 4U, 9U}) {
+        for (unsigned int output_channels : {1U, 7U, 8U, 9U, 50U}) {
+            for (unsigned int input_channels : {1U, 10U, 33U, 250U}) {
+                auto weights = VPUNN::random_uniform<float>({output_channels, input_channels}, -10.0f, 10.0f);
+                auto bias = VPUNN::random_uniform<float>({1, output_channels}, -10.0f, 10.0f);
+                auto input = VPUNN::random_uniform<float>({batch_size, input_channels}, -10.0f, 10.0f);
+                auto output = VPUNN::zeros<float>({batch_size, output_channels});
+                auto packed_output = VPUNN::zeros<float>({batch_size, output_channels});
+                auto packed_output_bias = VPUNN::zeros<float>({batch_size, output_channels});
+
+                VPUNN::Dense(&weights, &input, &output);
+
+                const VPUNN::PackedDenseWeights packed{weights, static_cast<int>(output_channels),
+                                                       static_cast<int>(input_channels)};
+                ASSERT_EQ(packed.output_channels(), static_cast<int>(output_channels));
+                ASSERT_EQ(packed.input_channels(), static_cast<int>(input_channels));
+                ASSERT_EQ(reinterpret_cast<std::uintptr_t>(packed.panel(0)) %
+                                  VPUNN::PackedDenseWeights::alignment_bytes,
+                          0U);
+                VPUNN::Dense(packed, &input, &packed_output);
+                VPUNN::Dense(packed, &input, &packed_output_bias, &bias);
+
+                for (int idx = 0; idx < output.size(); idx++) {
+                    const float tolerance{std::max(1e-3f, std::abs(output[idx]) * 1e-4f)};
+                    EXPECT_NEAR(packed_output[idx], output[idx], tolerance) << idx;
+                    // the bias is added to the product exactly like the BiasOp does
+                    EXPECT_FLOAT_EQ(packed_output_bias[idx], packed_output[idx] + bias[idx % output_channels]) << idx;
+                }
+            }
+        }
+    }
+
+    const auto weights = VPUNN::random_uniform<float>({10, 20}, -10.0f, 10.0f);
+    EXPECT_THROW(VPUNN::PackedDenseWeights(weights, 10, 21), std::runtime_error);
+    EXPECT_NO_THROW(VPUNN::PackedDenseWeights(weights, 20, 10));  // only the number of elements is known
+}
+
+TEST_F(TestFCLayer, PackedWeights_ReducedPrecision) {
+    for (auto precision : {VPUNN::WeightsPrecision::FP32, VPUNN::WeightsPrecision::BF16,
+                           VPUNN::WeightsPrecision::INT8}) {
+        EXPECT_EQ(VPUNN::weights_precision_from_string(VPUNN::to_string(precision)), precision);
+    }
+    EXPECT_EQ(VPUNN::weights_precision_from_string("FP16"), VPUNN::WeightsPrecision::FP32);
+
+    const unsigned int batch_size{5}, output_channels{19}, input_channels{70};
+    auto weights = VPUNN::random_uniform<float>({output_channels, input_channels}, -10.0f, 10.0f);
+    for (unsigned int k = 0; k < input_channels; k++) {
+        weights[3 * input_channels + k] = 0.0f;  // an output channel without weights
+    }
+    const auto bias = VPUNN::random_uniform<float>({1, output_channels}, -10.0f, 10.0f);
+    const auto input = VPUNN::random_uniform<float>({batch_size, input_channels}, -10.0f, 10.0f);
+
+    const VPUNN::PackedDenseWeights fp32{weights, static_cast<int>(output_channels), static_cast<int>(input_channels)};
+    auto expected = VPUNN::zeros<float>({batch_size, output_channels});
+    VPUNN::Dense(fp32, &input, &expected, &bias);
+
+    // |sum(a*w) - sum(a*w')| <= sum(|a|) * max|w - w'|
+    auto check = [&](VPUNN::WeightsPrecision precision, auto max_weight_error) {
+        const VPUNN::PackedDenseWeights packed{weights, static_cast<int>(output_channels),
+                                               static_cast<int>(input_channels), precision};
+        ASSERT_EQ(packed.precision(), precision);
+        EXPECT_EQ(packed.panel(0), nullptr);
+        EXPECT_LT(packed.size_in_bytes(), fp32.size_in_bytes());
+
+        auto output = VPUNN::zeros<float>({batch_size, output_channels});
+        VPUNN::Dense(packed, &input, &output, &bias);
+        for (unsigned int row = 0; row < batch_size; row++) {
+            float sum_abs_a{0.0f};
+            for (unsigned int k = 0; k < input_channels; k++) {
+                sum_abs_a += std::abs(input[row * input_channels + k]);
+            }
+            for (unsigned int out_ch = 0; out_ch < output_channels; out_ch++) {
+                const auto idx{row * output_channels + out_ch};
+                const float bound{sum_abs_a * max_weight_error(out_ch) + 1e-3f};
+                EXPECT_NEAR(output[idx], expected[idx], bound) << VPUNN::to_string(precision) << " " << idx;
+            }
+        }
+        const unsigned int zero_channel{3};
+        EXPECT_FLOAT_EQ(output[zero_channel], bias[zero_channel]);
+    };
+
+    check(VPUNN::WeightsPrecision::BF16, [](unsigned int) {
+        return 10.0f / 256.0f;  // 8 bits of mantissa
+    });
+    check(VPUNN::WeightsPrecision::INT8, [&weights](unsigned int out_ch) {
+        float max_abs{0.0f};
+        for (unsigned int k = 0; k < input_channels; k++) {
+            max_abs = std::max(max_abs, std::abs(weights[out_ch * input_channels + k]));
+        }
+        return max_abs / 127.0f / 2.0f;  // half of the channel quantization step
+    });
+}
+
 }  // namespace VPUNN_unit_tests
@@ -7,6 +7,7 @@
 // Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
 // Software Package for additional details.
 #include "vpu_layer_cost_model.h"
+#include "vpu_layer_cost_session.h"
 
 #include <gtest/gtest.h>
 #include <sstream>  // for error formating
@@ -110,6 +111,148 @@ TEST_F(VPULayerCostModelTest, Default_MaxWorkloadSPlitAndDetails_Test) {
     }
 }
 
+TEST_F(VPULayerCostModelTest, LayerCostSession_ReusesTiles) {
+    const VPUNN::DPULayer tst_layer(VPUNN::VPUDevice::VPU_2_7, VPUNN::Operation::CONVOLUTION,
+                                    {VPUNN::VPUTensor(28, 28, 64, 1, VPUNN::DataType::UINT8)},   // input dimensions
+                                    {VPUNN::VPUTensor(28, 28, 128, 1, VPUNN::DataType::UINT8)},  // output dimensions
+                                    {3, 3},                                                      // kernels
+                                    {1, 1},                                                      // strides
+                                    {1, 1, 1, 1}                                                 // padding
+    );
+    VPULayerCostModel& model{layer_models.getModel(VPUDevice::VPU_2_7)};
+    VPULayerCostSession session{model};
+
+    auto expect_same_as_model = [&model, &session, &tst_layer](const VPULayerStrategy& strategy) {
+        DPULayer direct_layer{tst_layer};
+        DPULayer session_layer{tst_layer};
+        LayerSplitInfo direct_split, session_split;
+        const auto direct_cost{model.Layer(direct_layer, strategy, direct_split)};
+        const auto session_cost{session.Layer(session_layer, strategy, session_split)};
+        EXPECT_EQ(session_cost, direct_cost) << strategy;
+        ASSERT_EQ(session_split.size(), direct_split.size()) << strategy;
+        for (size_t i = 0; i < direct_split.size(); i++) {
+            EXPECT_EQ(session_split[i].best_intra_tile_split.first, direct_split[i].best_intra_tile_split.first);
+            EXPECT_EQ(session_split[i].best_intra_tile_split.second, direct_split[i].best_intra_tile_split.second);
+            EXPECT_EQ(session_split[i].all_intra_tile_splits.size(), direct_split[i].all_intra_tile_splits.size());
+        }
+    };
+
+    VPULayerStrategy strategy{1U, 1U, 2U, VPUNN::VPUTilingStrategy::SOK, false, false, true};
+    expect_same_as_model(strategy);
+    const auto first{session.get_stats()};
+    EXPECT_EQ(first.layers, 1U);
+    EXPECT_GT(first.tiles_costed, 0U);
+    EXPECT_EQ(first.tiles_stored, first.tiles_costed);
+
+    // only the DDR context changes: the same tiles, nothing to split again
+    strategy.input_fetching = true;
+    strategy.prefetching = false;
+    expect_same_as_model(strategy);
+    const auto second{session.get_stats()};
+    EXPECT_EQ(second.tiles_costed, first.tiles_costed);
+    EXPECT_EQ(second.tiles_reused, first.tiles_reused + 2U);
+
+    // other tiles
+    strategy.tiling_strategy = VPUNN::VPUTilingStrategy::SOH_Overlapped;
+    expect_same_as_model(strategy);
+    EXPECT_GT(session.get_stats().tiles_costed, second.tiles_costed);
+
+    session.clear();
+    EXPECT_EQ(session.get_stats().tiles_stored, 0U);
+}
+
+TEST_F(VPULayerCostModelTest, SplitDetailLevel_KeepsOnlyRequestedSplits) {
+    const VPUNN::DPULayer tst_layer(VPUNN::VPUDevice::VPU_2_7, VPUNN::Operation::CONVOLUTION,
+                                    {VPUNN::VPUTensor(28, 28, 64, 1, VPUNN::DataType::UINT8)},   // input dimensions
+                                    {VPUNN::VPUTensor(28, 28, 128, 1, VPUNN::DataType::UINT8)},  // output dimensions
+                                    {3, 3},                                                      // kernels
+                                    {1, 1},                                                      // strides
+                                    {1, 1, 1, 1}                                                 // padding
+    );
+    VPULayerCostModel& model{model_2_7_no_dma};
+    const VPULayerStrategy strategy{2U, 1U, 2U, VPUNN::VPUTilingStrategy::SOH_Overlapped, false, false, true};
+
+    auto run = [&](SplitDetailLevel level, unsigned int top_k, LayerSplitInfo& split) {
+        model.set_splitDetailLevel(level, top_k);
+        DPULayer layer{tst_layer};
+        return model.Layer(layer, strategy, split);
+    };
+
+    LayerSplitInfo all, winner, top, none;
+    const auto cost_all{run(SplitDetailLevel::ALL, 0U, all)};
+    EXPECT_EQ(run(SplitDetailLevel::WINNER_ONLY, 0U, winner), cost_all);
+    EXPECT_EQ(run(SplitDetailLevel::TOP_K, 3U, top), cost_all);
+    EXPECT_EQ(run(SplitDetailLevel::NONE, 0U, none), cost_all);
+    model.set_splitDetailLevel(SplitDetailLevel::ALL);
+
+    ASSERT_EQ(all.size(), 2U);
+    ASSERT_EQ(winner.size(), all.size());
+    ASSERT_EQ(top.size(), all.size());
+    ASSERT_EQ(none.size(), all.size());
+    for (size_t i = 0; i < all.size(); i++) {
+        EXPECT_GT(all[i].all_intra_tile_splits.size(), 3U);
+
+        // the best split is always present, the candidates only as requested
+        EXPECT_EQ(winner[i].best_intra_tile_split, all[i].best_intra_tile_split);
+        EXPECT_EQ(none[i].best_intra_tile_split, all[i].best_intra_tile_split);
+        EXPECT_EQ(none[i].all_intra_tile_splits.size(), 0U);
+
+        ASSERT_EQ(winner[i].all_intra_tile_splits.size(), 1U);
+        EXPECT_EQ(winner[i].all_intra_tile_splits[0].workloads, all[i].best_intra_tile_split.second);
+
+        ASSERT_EQ(top[i].all_intra_tile_splits.size(), 3U);
+        EXPECT_EQ(top[i].all_intra_tile_splits[0].workloads, all[i].best_intra_tile_split.second);
+    }
+}
+
+TEST_F(VPULayerCostModelTest, Executor_SameResultsAsSerial) {
+    const VPUNN::DPULayer tst_layer(VPUNN::VPUDevice::VPU_2_7, VPUNN::Operation::CONVOLUTION,
+                                    {VPUNN::VPUTensor(56, 56, 64, 1, VPUNN::DataType::UINT8)},   // input dimensions
+                                    {VPUNN::VPUTensor(56, 56, 128, 1, VPUNN::DataType::UINT8)},  // output dimensions
+                                    {3, 3},                                                      // kernels
+                                    {1, 1},                                                      // strides
+                                    {1, 1, 1, 1}                                                 // padding
+    );
+    VPULayerCostModel& model{model_2_7_no_dma};
+    const std::vector<VPULayerStrategy> strategies{
+            {1U, 1U, 2U, VPUNN::VPUTilingStrategy::SOH_Overlapped, false, false, true},
+            {2U, 1U, 4U, VPUNN::VPUTilingStrategy::SOK, false, false, true},
+    };
+
+    auto run_all = [&]() {
+        std::vector<CyclesInterfaceType> costs;
+        std::vector<DPUWorkload> all_workloads;
+        for (const auto& strategy : strategies) {
+            DPULayer layer{tst_layer};
+            LayerSplitInfo split;
+            costs.push_back(model.Layer(layer, strategy, split));
+            for (const auto& tile : split) {
+                for (const auto& wl : tile.best_intra_tile_split.second) {
+                    all_workloads.push_back(wl);
+                }
+            }
+        }
+        // many workloads, the batched inference is split in chunks
+        while (all_workloads.size() < 200) {
+            all_workloads.insert(all_workloads.end(), all_workloads.cbegin(), all_workloads.cend());
+        }
+        const auto dpu_costs{model.get_cost_model().DPU(all_workloads)};
+        costs.insert(costs.end(), dpu_costs.cbegin(), dpu_costs.cend());
+        return costs;
+    };
+
+    const auto serial_costs{run_all()};
+    model.set_executor(std::make_shared<WorkStealingThreadPool>(WorkStealingThreadPool::Options{3}));
+    EXPECT_EQ(model.get_parallel_executor().concurrency(), 4U);
+    const auto parallel_costs{run_all()};
+    model.set_executor(nullptr);
+    EXPECT_EQ(model.get_parallel_executor().concurrency(), 1U);
+
+    ASSERT_EQ(parallel_costs.size(), serial_costs.size());
+    EXPECT_GT(serial_costs.size(), 200U);
+    EXPECT_EQ(parallel_costs, serial_costs);
+}
+
 TEST_F(VPULayerCostModelTest, 01_C01_CONVOLUTION_Multiply_6346) {
     const VPUNN::DPULayer tst_layer_ref(
             VPUNN::VPUDevice::VPU_2_7, VPUNN::Operation::CONVOLUTION,
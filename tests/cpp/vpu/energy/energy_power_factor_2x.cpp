@@ -200,6 +200,62 @@ TEST_F(TestEnergyandPF_CostModelVPU2x, SparseEnergy_FP16) {
     }
 }
 
+TEST_F(TestEnergyandPF_CostModelVPU2x, BatchEnergy_SameAsSingle) {
+    VPUCostModel crt_model{VPU_2_7_MODEL_PATH};
+
+    std::vector<DPUWorkload> wls{wl_list};
+    wls.insert(wls.end(), wl_list_FP.cbegin(), wl_list_FP.cend());
+
+    const std::vector<float> energies{crt_model.DPUEnergy(wls)};
+    ASSERT_EQ(energies.size(), wls.size());
+    for (std::size_t i = 0; i < wls.size(); ++i) {
+        EXPECT_EQ(energies[i], crt_model.DPUEnergy(wls[i])) << wls[i];
+        EXPECT_GT(energies[i], 0) << wls[i];
+    }
+
+    EXPECT_TRUE(crt_model.DPUEnergy(std::vector<DPUWorkload>{}).empty());
+}
+
+TEST_F(TestVPUPowerFactorLUTVPU2x, UnknownDeviceOrOperation) {
+    const VPUPowerFactorLUT power_factor_lut;
+    {  // no LUT for this device
+        DPUWorkload wl{VPUDevice::VPU_2_1,
+                       Operation::CONVOLUTION,
+                       {VPUTensor(56, 56, 64, 1, defaultTensorType)},
+                       outputs,
+                       kernels,
+                       strides,
+                       padding,
+                       execution_order};
+        EXPECT_EQ(power_factor_lut.getOperationAndPowerVirusAdjustementFactor(wl, performanceProvider), 0.0F) << wl;
+        EXPECT_EQ(power_factor_lut.get_PowerVirus_exceed_factor(wl.device), 1.0F);
+    }
+    {  // no samples for this operation
+        DPUWorkload wl{defaultDevice,
+                       Operation::LAYER_NORM,
+                       {VPUTensor(56, 56, 64, 1, defaultTensorType)},
+                       outputs,
+                       kernels,
+                       strides,
+                       padding,
+                       execution_order};
+        EXPECT_EQ(power_factor_lut.getOperationAndPowerVirusAdjustementFactor(wl, performanceProvider), 0.0F) << wl;
+    }
+    {  // zero channels behaves as the first sample
+        DPUWorkload wl{defaultDevice,
+                       Operation::CONVOLUTION,
+                       {VPUTensor(56, 56, 0, 1, defaultTensorType)},
+                       outputs,
+                       kernels,
+                       strides,
+                       padding,
+                       execution_order};
+        EXPECT_NEAR(power_factor_lut.getOperationAndPowerVirusAdjustementFactor(wl, performanceProvider),
+                    0.87F * refPowerVirusFactor, 0.001)
+                << wl;
+    }
+}
+
 TEST_F(TestVPUPowerFactorLUTVPU2x, InsideMatchSamples) {
     const VPUPowerFactorLUT power_factor_lut;
 
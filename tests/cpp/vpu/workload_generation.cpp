@@ -6,9 +6,11 @@
 // included in or with the Software Package, and your use indicates your acceptance of all such terms.
 // Please refer to the “third-party-programs.txt” or other similarly-named text file included with the
 // Software Package for additional details.
+#include "vpu/optimization/split_pool.h"
 #include "vpu/optimization/workload_optimization.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 #include "common/common_helpers.h"
@@ -69,7 +71,7 @@ protected:
 
         for (const VPUNN::VPUOptimizationTarget target :
              {VPUNN::VPUOptimizationTarget::POWER, VPUNN::VPUOptimizationTarget::LATENCY,
-              VPUNN::VPUOptimizationTarget::EFFICIENCY}) {
+              VPUNN::VPUOptimizationTarget::EFFICIENCY, VPUNN::VPUOptimizationTarget::EDP}) {
             for (const VPUNN::VPUSplitStrategy strategy :
                  {VPUNN::VPUSplitStrategy::HW_TILING, VPUNN::VPUSplitStrategy::Z_TILING,
                   VPUNN::VPUSplitStrategy::H_TILING, VPUNN::VPUSplitStrategy::W_TILING}) {
@@ -183,80 +185,207 @@ TEST_F(WorkloadGeneration, WorkloadGenerationCreateTilerMultipleWLs) {
 
             std::unique_ptr<VPUNN::IDPUTiler> tiler = VPUNN::getDPUTiler(*model);
 
-            if (options.target == VPUNN::VPUOptimizationTarget::POWER) {
-                EXPECT_THROW(
-                        {  // block to throw
-                            try {
-                                tiler->intraTileSplit(layer, options);
-                            } catch (std::runtime_error const& err) {
-                                // and this tests that it has the correct message
-                                EXPECT_STREQ("generateSplits: not Handling VPUOptimizationTarget::POWER", err.what())
-                                        << " \n target:" << (int)options.target
-                                        << " \n availableStrategies:" << (int)options.availableStrategies[0]
-                                        << " \n maxWorkloads:" << options.maxWorkloads
-                                        << " \n maxLatencyUs:" << options.maxLatencyUs << " \n nDPU:" << options.nDPU
-                                        << " \n runtimeOverhead:" << options.runtimeOverhead << std::endl
-                                        << " \n Model: " << what_model_is(model) << std::endl
-                                        << layer << std::endl;
-                                throw;
-                            } catch (std::out_of_range const& err) {
-                                // this is here to catch the situation when the WL is not usable with this NN
-                                //@todo: rewrite the test to consider the VPUNNmodel particularities.
-                                std::cout << "\n OUT of RANGE (target=POWER(1)) exception when intraTileSplit(), "
-                                             "probably bad WL input for the VPUNN \n ERR: "
-                                          << err.what() << std::endl
-                                          << layer << std::endl
-                                          << " \n target:" << (int)options.target
-                                          << " \n availableStrategies:" << (int)options.availableStrategies[0]
-                                          << " \n maxWorkloads:" << options.maxWorkloads
-                                          << " \n maxLatencyUs:" << options.maxLatencyUs << " \n nDPU:" << options.nDPU
-                                          << " \n runtimeOverhead:" << options.runtimeOverhead << std::endl
-                                          << " \n Model: " << what_model_is(model) << std::endl
-                                          << " \n Throwing a runtime error \"Force Valid\": " << std::endl
-                                          << std::endl;
-                                throw std::runtime_error("Force Valid!");
-                            } catch (...) {
-                                FAIL() << "Expected std::runtime_error"
-                                       << " \n target:" << (int)options.target
-                                       << " \n availableStrategies:" << (int)options.availableStrategies[0]
-                                       << " \n maxWorkloads:" << options.maxWorkloads
-                                       << " \n maxLatencyUs:" << options.maxLatencyUs << " \n nDPU:" << options.nDPU
-                                       << " \n runtimeOverhead:" << options.runtimeOverhead << std::endl
-                                       << " \n Model: " << what_model_is(model) << std::endl
-                                       << std::endl;
-                            }
-                        },  // end of block to throw
-                        std::runtime_error)
-                        << "\n NOT THROWING properly (target=POWER(1))"
-                        << " \n target:" << (int)options.target
-                        << " \n availableStrategies:" << (int)options.availableStrategies[0]
-                        << " \n maxWorkloads:" << options.maxWorkloads << " \n maxLatencyUs:" << options.maxLatencyUs
-                        << " \n nDPU:" << options.nDPU << " \n runtimeOverhead:" << options.runtimeOverhead
-                        << " \n Model: " << what_model_is(model) << std::endl
-                        << std::endl;
-            } else {
-                // Split the layer into multiple workloads
-                try {
-                    auto workloads = tiler->intraTileSplit(layer, options);
-                    // Validate workloads
-                    validate_wl(layer, workloads.second);
-                } catch (std::out_of_range const& err) {
-                    // this is here to catch the situation when the WL is not usable with this NN
-                    //@todo: rewrite the test to consider the VPUNNmodel particularities.
-                    std::cout << "\n  OUT of RANGE (target= rest (0,2) exception when intraTileSplit(), probably bad "
-                                 "WL input for the VPUNN \n ERR: "
-                              << err.what() << std::endl
-                              << layer << " \n target:" << (int)options.target
-                              << " \n availableStrategies:" << (int)options.availableStrategies[0]
-                              << " \n maxWorkloads:" << options.maxWorkloads
-                              << " \n maxLatencyUs:" << options.maxLatencyUs << " \n nDPU:" << options.nDPU
-                              << " \n runtimeOverhead:" << options.runtimeOverhead
-                              << " \n Model: " << what_model_is(model) << std::endl
-                              << std::endl;
-                }
+            // Split the layer into multiple workloads
+            try {
+                auto workloads = tiler->intraTileSplit(layer, options);
+                // Validate workloads
+                validate_wl(layer, workloads.second);
+            } catch (std::out_of_range const& err) {
+                // this is here to catch the situation when the WL is not usable with this NN
+                //@todo: rewrite the test to consider the VPUNNmodel particularities.
+                std::cout << "\n  OUT of RANGE exception when intraTileSplit(), probably bad "
+                             "WL input for the VPUNN \n ERR: "
+                          << err.what() << std::endl
+                          << layer << " \n target:" << (int)options.target
+                          << " \n availableStrategies:" << (int)options.availableStrategies[0]
+                          << " \n maxWorkloads:" << options.maxWorkloads
+                          << " \n maxLatencyUs:" << options.maxLatencyUs << " \n nDPU:" << options.nDPU
+                          << " \n runtimeOverhead:" << options.runtimeOverhead
+                          << " \n Model: " << what_model_is(model) << std::endl
+                          << std::endl;
             }
         }
     }
 }
 
+
+TEST_F(WorkloadGeneration, EnergyTargets_and_ParetoFront) {
+    VPUNN::SplitOptions options;
+    options.nDPU = 4;
+    options.maxWorkloads = 64;
+    options.availableStrategies = {VPUNN::VPUSplitStrategy::HW_TILING, VPUNN::VPUSplitStrategy::Z_TILING};
+
+    auto layer = generate_helper_layer(VPUNN::VPUDevice::VPU_2_7, 56, 64, 3);
+    std::unique_ptr<VPUNN::IDPUTiler> tiler = VPUNN::getDPUTiler(model_2_7);
+
+    auto energy_of = [this](const VPUNN::DPUWorkloads& wls) {
+        float energy{0.0f};
+        for (const auto& e : model_2_7.DPUEnergy(wls)) {
+            energy += e;
+        }
+        return energy;
+    };
+
+    options.target = VPUNN::VPUOptimizationTarget::LATENCY;
+    auto latency_best = tiler->intraTileSplit(layer, options);
+    validate_wl(layer, latency_best.second);
+
+    options.target = VPUNN::VPUOptimizationTarget::POWER;
+    std::vector<VPUNN::DPUWorkloadsWithCyclesSplit> all_splits;
+    auto power_best = tiler->intraTileSplit(layer, options, &all_splits);
+    validate_wl(layer, power_best.second);
+    ASSERT_FALSE(all_splits.empty());
+
+    EXPECT_LE(energy_of(power_best.second), energy_of(latency_best.second));
+    EXPECT_GE(power_best.first, latency_best.first);
+    EXPECT_TRUE(std::all_of(all_splits.cbegin(), all_splits.cend(), [](const auto& split) {
+        return split.energy.size() == split.workloads.size();  // energy per workload was computed
+    }));
+
+    options.target = VPUNN::VPUOptimizationTarget::EDP;
+    auto edp_best = tiler->intraTileSplit(layer, options);
+    validate_wl(layer, edp_best.second);
+    const double edp{static_cast<double>(energy_of(edp_best.second)) * edp_best.first};
+    EXPECT_LE(edp, static_cast<double>(energy_of(latency_best.second)) * latency_best.first);
+    EXPECT_LE(edp, static_cast<double>(energy_of(power_best.second)) * power_best.first);
+
+    const auto front = tiler->intraTileParetoFront(layer, options);
+    ASSERT_FALSE(front.empty());
+    EXPECT_EQ(front.front().cycles, latency_best.first);
+    EXPECT_FLOAT_EQ(front.back().energy, energy_of(power_best.second));
+    for (size_t i = 1; i < front.size(); ++i) {  // strictly faster and strictly more energy hungry
+        EXPECT_LT(front[i - 1].cycles, front[i].cycles);
+        EXPECT_GT(front[i - 1].energy, front[i].energy);
+    }
+}
+
+// The pruned search selects the same split as the full search, costing less splits
+TEST_F(WorkloadGeneration, PrunedSearch_SameAsFullSearch) {
+    unsigned int total_pruned{0};
+    for (auto* model : {&model_2_7, &model_2_0, &model_theoretical}) {
+        std::unique_ptr<VPUNN::IDPUTiler> tiler = VPUNN::getDPUTiler(*model);
+        for (const auto& [dim, channels, kernel] : {std::make_tuple(56U, 64U, 3U), std::make_tuple(28U, 128U, 1U),
+                                                    std::make_tuple(14U, 256U, 3U), std::make_tuple(7U, 512U, 1U)}) {
+            const auto layer = generate_helper_layer(make_compatible_device(model), dim, channels, kernel);
+            for (const unsigned int runtimeOverhead : {0U, 100U}) {
+                VPUNN::SplitOptions options;
+                options.nDPU = 4;
+                options.maxWorkloads = 64;
+                options.runtimeOverhead = runtimeOverhead;
+                const std::string info{what_model_is(model) + " layer: " + std::to_string(dim) + "x" +
+                                       std::to_string(channels) + " k" + std::to_string(kernel) +
+                                       " overhead: " + std::to_string(runtimeOverhead)};
+
+                VPUNN::SplitSearchStats full_stats;
+                const auto full = tiler->intraTileSplit(layer, options, nullptr, &full_stats);
+
+                options.pruneSplits = true;
+                VPUNN::SplitSearchStats pruned_stats;
+                std::vector<VPUNN::DPUWorkloadsWithCyclesSplit> costed_splits;
+                const auto pruned = tiler->intraTileSplit(layer, options, &costed_splits, &pruned_stats);
+
+                EXPECT_EQ(pruned.first, full.first) << info;
+                EXPECT_EQ(pruned.second, full.second) << info;
+
+                EXPECT_EQ(full_stats.candidates, full_stats.costed) << info;
+                EXPECT_EQ(full_stats.pruned, 0U) << info;
+                EXPECT_EQ(pruned_stats.candidates, full_stats.candidates) << info;
+                EXPECT_EQ(pruned_stats.costed + pruned_stats.pruned, pruned_stats.candidates) << info;
+                EXPECT_EQ(costed_splits.size(), pruned_stats.costed) << info;
+                total_pruned += pruned_stats.pruned;
+            }
+        }
+    }
+    EXPECT_GT(total_pruned, 0U) << "pruning never happened";
+
+    {  // energy targets are not pruned
+        std::unique_ptr<VPUNN::IDPUTiler> tiler = VPUNN::getDPUTiler(model_2_7);
+        VPUNN::SplitOptions options;
+        options.nDPU = 4;
+        options.target = VPUNN::VPUOptimizationTarget::POWER;
+        options.pruneSplits = true;
+        VPUNN::SplitSearchStats stats;
+        tiler->intraTileSplit(generate_helper_layer(VPUNN::VPUDevice::VPU_2_7, 28, 64, 3), options, nullptr, &stats);
+        EXPECT_EQ(stats.pruned, 0U);
+        EXPECT_EQ(stats.costed, stats.candidates);
+    }
+}
+
+// Workloads that differ only by offsets are costed once, the result is the same as costing each of them
+TEST_F(WorkloadGeneration, LayerPerformance_ShapeClasses) {
+    const auto layer = generate_helper_layer(VPUNN::VPUDevice::VPU_2_7, 16, 64, 3);
+    VPUNN::DPUWorkload wl{layer};
+    wl.execution_order = VPUNN::ExecutionMode::CUBOID_16x16;
+
+    VPUNN::DPUWorkloadsWithCyclesSplit split;
+    for (unsigned int i = 0; i < 9; i++) {  // same shape, different positions
+        VPUNN::DPUWorkload w{wl};
+        w.offsets = {16 * (i % 3), 16 * (i / 3), 0, 0};
+        w.set_layer_info("piece_" + std::to_string(i));
+        split.workloads.push_back(w);
+    }
+    VPUNN::DPUWorkload other{wl};  // another shape class
+    other.inputs[0] = VPUNN::VPUTensor(16, 8, 64, 1, VPUNN::DataType::FLOAT16);
+    other.outputs[0] = VPUNN::VPUTensor(16, 8, 64, 1, VPUNN::DataType::FLOAT16);
+    split.workloads.insert(split.workloads.begin() + 4, other);
+    split.cycles.resize(split.workloads.size());
+
+    std::unique_ptr<VPUNN::IDPUTiler> tiler = VPUNN::getDPUTiler(model_2_7);
+    const auto pnp = tiler->getLayerPerformance(split, 10, false);
+
+    ASSERT_FALSE(VPUNN::Cycles::isErrorCode(pnp.cycles)) << VPUNN::Cycles::toErrorText(pnp.cycles);
+    ASSERT_EQ(split.cycles.size(), split.workloads.size());
+    ASSERT_EQ(split.energy.size(), split.workloads.size());
+    std::vector<VPUNN::CyclesInterfaceType> expected_cycles;
+    float expected_energy{0.0f};
+    for (size_t i = 0; i < split.workloads.size(); i++) {
+        std::string info;
+        expected_cycles.push_back(model_2_7.DPU(split.workloads[i], info));
+        EXPECT_EQ(split.cycles[i], expected_cycles.back()) << i;
+        EXPECT_FLOAT_EQ(split.energy[i], model_2_7.DPUEnergy(split.workloads[i])) << i;
+        expected_energy += split.energy[i];
+    }
+    EXPECT_NE(split.cycles[0], split.cycles[4]);
+    const auto nDPU{model_2_7.getPerformanceModel().get_hw_info(VPUNN::VPUDevice::VPU_2_7).nDPU_per_tile()};
+    EXPECT_EQ(pnp.cycles, VPUNN::dpu_schedule(nDPU, expected_cycles, 10U));
+    EXPECT_FLOAT_EQ(pnp.energy, expected_energy);
+}
+
+TEST_F(WorkloadGeneration, SplitPool_FlatStorage) {
+    const auto layer = generate_helper_layer(VPUNN::VPUDevice::VPU_2_7, 16, 64, 3);
+    VPUNN::DPUWorkload wl{layer};
+
+    VPUNN::SplitPool pool{1024};  // small arena, will grow
+    std::vector<VPUNN::DPUWorkloads> added;
+    for (unsigned int n = 1; n <= 20; n++) {
+        VPUNN::DPUWorkloadsWithCyclesSplit split;
+        for (unsigned int i = 0; i < n; i++) {
+            VPUNN::DPUWorkload w{wl};
+            w.offsets = {i, n, 0, 0};
+            split.workloads.push_back(w);
+        }
+        added.push_back(split.workloads);
+        EXPECT_EQ(pool.add(std::move(split)), n - 1);
+    }
+    ASSERT_EQ(pool.size(), added.size());
+
+    pool[3].cost = 100;
+    pool[3].costed = true;
+    pool.cycles_of(3)[2] = 42;
+    pool.energy_of(3)[1] = 1.5f;
+
+    for (size_t idx = 0; idx < pool.size(); idx++) {
+        EXPECT_EQ(pool[idx].count, added[idx].size());
+        EXPECT_EQ(pool.materialize(idx), added[idx]) << idx;
+    }
+
+    const auto split3{pool.materialize_split(3, true)};
+    EXPECT_EQ(split3.workloads, added[3]);
+    ASSERT_EQ(split3.cycles.size(), 4U);
+    EXPECT_EQ(split3.cycles[2], 42U);
+    ASSERT_EQ(split3.energy.size(), 4U);
+    EXPECT_FLOAT_EQ(split3.energy[1], 1.5f);
+    EXPECT_TRUE(pool.materialize_split(3, false).energy.empty());
+}
+
 }  // namespace VPUNN_unit_tests